@@ -0,0 +1,117 @@
+# Build types, optimization options and profile-guided optimization.
+#
+# Build types (CMAKE_BUILD_TYPE, or --config with multi-config generators):
+#   Release         -O3, the default; what benchmarks should be run with
+#   RelWithDebInfo  -O2 -g, for profilers
+#   Debug           -O0 -g
+#   ASan            AddressSanitizer and UndefinedBehaviorSanitizer
+#   TSan            ThreadSanitizer, for the concurrent containers
+#
+# Options:
+#   GAME_DEV_NATIVE  Compile for the build machine (-march=native)
+#   GAME_DEV_LTO     Link-time optimization for Release and RelWithDebInfo
+#   GAME_DEV_PGO     OFF, GENERATE or USE. Build with GENERATE, run the
+#                    programs to be optimized, then reconfigure the same
+#                    build directory with USE and rebuild.
+#   GAME_DEV_PROFILER
+#                    Compile in the PROFILE_ZONE markers and the counting
+#                    operator new (projects/c++_fundamentals/profiler)
+
+include(CheckCXXCompilerFlag)
+include(CheckIPOSupported)
+
+set(GAME_DEV_BUILD_TYPES Debug Release RelWithDebInfo ASan TSan)
+
+get_property(multiConfig GLOBAL PROPERTY GENERATOR_IS_MULTI_CONFIG)
+if(multiConfig)
+  set(CMAKE_CONFIGURATION_TYPES "${GAME_DEV_BUILD_TYPES}" CACHE STRING "" FORCE)
+else()
+  if(NOT CMAKE_BUILD_TYPE)
+    set(CMAKE_BUILD_TYPE Release CACHE STRING "Build type" FORCE)
+  endif()
+  set_property(CACHE CMAKE_BUILD_TYPE PROPERTY STRINGS ${GAME_DEV_BUILD_TYPES})
+  if(NOT CMAKE_BUILD_TYPE IN_LIST GAME_DEV_BUILD_TYPES)
+    message(FATAL_ERROR "Unknown build type ${CMAKE_BUILD_TYPE}; use one of "
+                        "${GAME_DEV_BUILD_TYPES}")
+  endif()
+endif()
+
+set(asanFlags "-O1 -g -fno-omit-frame-pointer -fsanitize=address,undefined")
+set(tsanFlags "-O1 -g -fno-omit-frame-pointer -fsanitize=thread")
+# project() already created this cache entry, empty, when one of the
+# sanitizer types was selected on the command line; fill it in unless
+# someone has set it. The compile flags are also passed when linking, which
+# pulls in the sanitizer runtimes.
+foreach(profile ASAN TSAN)
+  string(TOLOWER ${profile} lower)
+  if(NOT CMAKE_CXX_FLAGS_${profile})
+    set(CMAKE_CXX_FLAGS_${profile} "${${lower}Flags}" CACHE STRING
+        "Flags for the ${profile} build type" FORCE)
+  endif()
+  mark_as_advanced(CMAKE_CXX_FLAGS_${profile})
+endforeach()
+
+if(CMAKE_CXX_COMPILER_ID MATCHES "GNU|Clang")
+  add_compile_options(-Wall -Wextra)
+endif()
+
+option(GAME_DEV_NATIVE "Compile for the build machine (-march=native)" OFF)
+if(GAME_DEV_NATIVE)
+  check_cxx_compiler_flag(-march=native compilerHasMarchNative)
+  if(NOT compilerHasMarchNative)
+    message(FATAL_ERROR "GAME_DEV_NATIVE: the compiler rejects -march=native")
+  endif()
+  add_compile_options(-march=native)
+endif()
+
+# Defined for every target, so an inline function has the same zones in
+# every translation unit that includes it
+option(GAME_DEV_PROFILER "Compile in the scoped-zone profiler" OFF)
+if(GAME_DEV_PROFILER)
+  add_compile_definitions(GAME_DEV_PROFILE)
+endif()
+
+option(GAME_DEV_LTO "Link-time optimization for optimized builds" ON)
+if(GAME_DEV_LTO)
+  check_ipo_supported(RESULT ipoSupported OUTPUT ipoError LANGUAGES CXX)
+  if(ipoSupported)
+    set(CMAKE_INTERPROCEDURAL_OPTIMIZATION_RELEASE ON)
+    set(CMAKE_INTERPROCEDURAL_OPTIMIZATION_RELWITHDEBINFO ON)
+  else()
+    message(WARNING "GAME_DEV_LTO: not supported here, building without it\n"
+                    "${ipoError}")
+  endif()
+endif()
+
+set(GAME_DEV_PGO OFF CACHE STRING "Profile-guided optimization stage")
+set_property(CACHE GAME_DEV_PGO PROPERTY STRINGS OFF GENERATE USE)
+set(GAME_DEV_PGO_DIR "${CMAKE_BINARY_DIR}/pgo-profiles" CACHE PATH
+    "Where GENERATE writes profiles and USE reads them")
+
+if(GAME_DEV_PGO STREQUAL "GENERATE")
+  if(CMAKE_CXX_COMPILER_ID STREQUAL "GNU")
+    set(pgoFlags "-fprofile-generate=${GAME_DEV_PGO_DIR}" -fprofile-update=atomic)
+  elseif(CMAKE_CXX_COMPILER_ID MATCHES "Clang")
+    set(pgoFlags "-fprofile-instr-generate=${GAME_DEV_PGO_DIR}/%m-%p.profraw")
+  endif()
+elseif(GAME_DEV_PGO STREQUAL "USE")
+  if(CMAKE_CXX_COMPILER_ID STREQUAL "GNU")
+    # Programs that were not run have no profile; that is expected
+    set(pgoFlags "-fprofile-use=${GAME_DEV_PGO_DIR}" -fprofile-correction
+                 -Wno-missing-profile)
+  elseif(CMAKE_CXX_COMPILER_ID MATCHES "Clang")
+    # Merge first: llvm-profdata merge -o default.profdata *.profraw
+    set(pgoFlags "-fprofile-instr-use=${GAME_DEV_PGO_DIR}/default.profdata"
+                 -Wno-profile-instr-unprofiled)
+  endif()
+elseif(NOT GAME_DEV_PGO STREQUAL "OFF")
+  message(FATAL_ERROR "GAME_DEV_PGO must be OFF, GENERATE or USE")
+endif()
+
+if(NOT GAME_DEV_PGO STREQUAL "OFF")
+  if(NOT pgoFlags)
+    message(FATAL_ERROR "GAME_DEV_PGO needs GCC or Clang")
+  endif()
+  add_compile_options(${pgoFlags})
+  add_link_options(${pgoFlags})
+endif()
@@ -0,0 +1,21 @@
+# add_exercise(<source> [SOURCES <extra sources>...] [LIBRARIES <libs>...])
+#
+# One executable per program. The target is named <directory>_<stem>, since
+# many exercises have a main.cpp, while the binary keeps the stem of its
+# source and lands in the matching build directory, e.g.
+# build/projects/.../exercise_4/benchmark.
+function(add_exercise source)
+  cmake_parse_arguments(EXERCISE "" "" "SOURCES;LIBRARIES" ${ARGN})
+  get_filename_component(stem "${source}" NAME_WE)
+  get_filename_component(directory "${CMAKE_CURRENT_SOURCE_DIR}" NAME)
+  set(target "${directory}_${stem}")
+
+  add_executable(${target} ${source} ${EXERCISE_SOURCES})
+  set_target_properties(${target} PROPERTIES OUTPUT_NAME ${stem})
+  target_link_libraries(${target} PRIVATE Threads::Threads
+                                          ${EXERCISE_LIBRARIES})
+  # Any program may include an instrumented header
+  if(GAME_DEV_PROFILER)
+    target_link_libraries(${target} PRIVATE Profiler)
+  endif()
+endfunction()
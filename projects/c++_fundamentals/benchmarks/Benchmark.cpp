@@ -0,0 +1,533 @@
+#include "Benchmark.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <system_error>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sched.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+struct Registered {
+  std::string name;
+  BenchmarkBody body;
+};
+
+std::vector<Registered>& registry() {
+  static std::vector<Registered> benchmarks;
+  return benchmarks;
+}
+
+// Hardware counters for the calling thread, read as one group so they
+// cover exactly the same interval. Any event the kernel refuses (no PMU in
+// a VM, perf_event_paranoid too strict) is left out; if the first one is
+// refused there are no counters at all.
+class PerfCounters {
+ public:
+  PerfCounters() : leader(-1) {}
+
+  ~PerfCounters() {
+#if defined(__linux__)
+    for (const Event& event : events) {
+      close(event.fd);
+    }
+#endif
+  }
+
+  PerfCounters(const PerfCounters&) = delete;
+  PerfCounters& operator=(const PerfCounters&) = delete;
+
+  void open() {
+#if defined(__linux__)
+    add("cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+    add("instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+    add("branch_misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+    add("cache_misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+#endif
+  }
+
+  bool available() const { return leader >= 0; }
+
+  void start() {
+#if defined(__linux__)
+    if (available()) {
+      ioctl(leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+      ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+#endif
+  }
+
+  // Counts since start(), scaled up if the kernel multiplexed the group
+  std::vector<std::pair<std::string, double>> stop() {
+    std::vector<std::pair<std::string, double>> counts;
+#if defined(__linux__)
+    if (!available()) {
+      return counts;
+    }
+    ioctl(leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+    // nr, time_enabled, time_running, then one value per event
+    std::vector<uint64_t> buffer(3 + events.size());
+    ssize_t size = read(leader, buffer.data(), buffer.size() * 8);
+    if (size < ssize_t(3 * 8) || buffer[2] == 0) {
+      return counts;
+    }
+    double scale = double(buffer[1]) / double(buffer[2]);
+    for (size_t i = 0; i < events.size() && i < buffer[0]; i++) {
+      counts.emplace_back(events[i].name, double(buffer[3 + i]) * scale);
+    }
+#endif
+    return counts;
+  }
+
+ private:
+  struct Event {
+    std::string name;
+    int fd;
+  };
+
+  static const int kRefused = -2;
+
+  int leader;  // -1 before open()
+  std::vector<Event> events;
+
+#if defined(__linux__)
+  void add(const char* name, uint32_t type, uint64_t config) {
+    if (leader == kRefused) {
+      return;
+    }
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    // The group starts and stops with its leader
+    attr.disabled = leader < 0;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED |
+                       PERF_FORMAT_TOTAL_TIME_RUNNING;
+    int fd = int(syscall(SYS_perf_event_open, &attr, 0, -1, leader, 0));
+    if (fd < 0) {
+      if (leader < 0) {
+        leader = kRefused;
+      }
+      return;
+    }
+    if (leader < 0) {
+      leader = fd;
+    }
+    events.push_back({name, fd});
+  }
+#endif
+};
+
+double secondsSince(Clock::time_point start) {
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+double timeRun(const BenchmarkBody& body, uint64_t iterations) {
+  Clock::time_point start = Clock::now();
+  body(iterations);
+  clobberMemory();
+  return secondsSince(start);
+}
+
+// A body that still finishes in under minTime after this many iterations
+// has most likely been optimized away
+const uint64_t kMaxIterations = uint64_t(1) << 40;
+
+// Grows the iteration count until one run takes at least minTime
+uint64_t calibrate(const BenchmarkBody& body, double minTime) {
+  uint64_t iterations = 1;
+  while (true) {
+    double elapsed = timeRun(body, iterations);
+    if (elapsed >= minTime || iterations >= kMaxIterations) {
+      return iterations;
+    }
+    double factor = elapsed > 0 ? 1.4 * minTime / elapsed : 10;
+    factor = std::min(10.0, std::max(2.0, factor));
+    iterations = std::min(kMaxIterations,
+                          uint64_t(std::ceil(iterations * factor)));
+  }
+}
+
+void summarize(BenchmarkResult& result) {
+  std::vector<double> sorted = result.samples;
+  std::sort(sorted.begin(), sorted.end());
+  size_t n = sorted.size();
+  result.minNs = sorted.front();
+  result.medianNs =
+      n % 2 ? sorted[n / 2] : (sorted[n / 2 - 1] + sorted[n / 2]) / 2;
+  double sum = 0;
+  for (double sample : sorted) {
+    sum += sample;
+  }
+  result.meanNs = sum / n;
+  double squares = 0;
+  for (double sample : sorted) {
+    squares += (sample - result.meanNs) * (sample - result.meanNs);
+  }
+  result.stddevNs = n > 1 ? std::sqrt(squares / (n - 1)) : 0;
+
+  std::vector<double> deviations;
+  for (double sample : sorted) {
+    deviations.push_back(std::abs(sample - result.medianNs));
+  }
+  std::sort(deviations.begin(), deviations.end());
+  result.madNs = n % 2 ? deviations[n / 2]
+                       : (deviations[n / 2 - 1] + deviations[n / 2]) / 2;
+}
+
+void pinToCpu(int cpu) {
+#if defined(__linux__)
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cpu, &set);
+  if (sched_setaffinity(0, sizeof(set), &set) != 0) {
+    throw std::system_error(errno, std::generic_category(),
+                            "Cannot pin to CPU " + std::to_string(cpu));
+  }
+#else
+  throw std::runtime_error("CPU pinning is only supported on Linux");
+#endif
+}
+
+std::string jsonEscape(const std::string& text) {
+  std::string escaped;
+  for (char c : text) {
+    if (c == '"' || c == '\\') {
+      escaped += '\\';
+    }
+    escaped += c;
+  }
+  return escaped;
+}
+
+void printResult(std::ostream& log, const BenchmarkResult& result) {
+  std::ostringstream line;
+  line << std::fixed << std::setprecision(2) << std::left << std::setw(40)
+       << result.name << std::right << std::setw(12) << result.iterations
+       << std::setw(12) << result.medianNs << std::setw(8)
+       << (result.medianNs > 0 ? 100 * result.stddevNs / result.medianNs : 0)
+       << "%" << std::setw(12) << result.minNs;
+  double cycles = 0, instructions = 0;
+  for (const auto& counter : result.counters) {
+    if (counter.first == "cycles") {
+      cycles = counter.second;
+    } else if (counter.first == "instructions") {
+      instructions = counter.second;
+    }
+  }
+  if (cycles > 0) {
+    line << std::setw(10) << cycles << std::setw(7) << instructions / cycles;
+  }
+  log << line.str() << std::endl;
+}
+
+}  // namespace
+
+void registerBenchmark(const std::string& name, BenchmarkBody body) {
+  registry().push_back({name, std::move(body)});
+}
+
+std::vector<BenchmarkResult> runBenchmarks(const BenchmarkOptions& options,
+                                           std::ostream& log) {
+  if (options.repetitions < 1) {
+    throw std::invalid_argument("Need at least one repetition");
+  }
+  if (options.cpu >= 0) {
+    pinToCpu(options.cpu);
+  }
+  PerfCounters counters;
+  if (options.counters) {
+    counters.open();
+  }
+
+  log << std::left << std::setw(40) << "benchmark" << std::right
+      << std::setw(12) << "iterations" << std::setw(12) << "median ns"
+      << std::setw(9) << "stddev" << std::setw(12) << "min ns";
+  if (counters.available()) {
+    log << std::setw(10) << "cycles" << std::setw(7) << "IPC";
+  }
+  log << std::endl;
+
+  double minTime = std::chrono::duration<double>(options.minTime).count();
+  double warmup = std::chrono::duration<double>(options.warmup).count();
+  std::vector<BenchmarkResult> results;
+  for (const Registered& benchmark : registry()) {
+    if (benchmark.name.find(options.filter) == std::string::npos) {
+      continue;
+    }
+    BenchmarkResult result;
+    result.name = benchmark.name;
+    result.iterations = calibrate(benchmark.body, minTime);
+
+    Clock::time_point warmupStart = Clock::now();
+    do {
+      timeRun(benchmark.body, result.iterations);
+    } while (secondsSince(warmupStart) < warmup);
+
+    std::vector<std::pair<std::string, double>> totals;
+    for (int i = 0; i < options.repetitions; i++) {
+      counters.start();
+      double elapsed = timeRun(benchmark.body, result.iterations);
+      std::vector<std::pair<std::string, double>> counts = counters.stop();
+      result.samples.push_back(elapsed * 1e9 / result.iterations);
+      if (totals.empty()) {
+        totals = counts;
+      } else {
+        for (size_t c = 0; c < totals.size() && c < counts.size(); c++) {
+          totals[c].second += counts[c].second;
+        }
+      }
+    }
+    for (auto& total : totals) {
+      total.second /= double(result.iterations) * options.repetitions;
+    }
+    result.counters = totals;
+    summarize(result);
+    printResult(log, result);
+    results.push_back(std::move(result));
+  }
+  return results;
+}
+
+void writeJson(std::ostream& out, const std::vector<BenchmarkResult>& results,
+               const BenchmarkOptions& options) {
+  std::time_t now = std::time(nullptr);
+  char date[32];
+  std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+
+  out << std::setprecision(6);
+  out << "{\n  \"context\": {\n"
+      << "    \"date\": \"" << date << "\",\n"
+      << "    \"repetitions\": " << options.repetitions << ",\n"
+      << "    \"min_time_ms\": " << options.minTime.count() << ",\n"
+      << "    \"warmup_ms\": " << options.warmup.count() << ",\n"
+      << "    \"cpu\": " << options.cpu << "\n"
+      << "  },\n  \"benchmarks\": [";
+  for (size_t i = 0; i < results.size(); i++) {
+    const BenchmarkResult& result = results[i];
+    out << (i ? "," : "") << "\n    {\n"
+        << "      \"name\": \"" << jsonEscape(result.name) << "\",\n"
+        << "      \"iterations\": " << result.iterations << ",\n"
+        << "      \"median_ns\": " << result.medianNs << ",\n"
+        << "      \"mean_ns\": " << result.meanNs << ",\n"
+        << "      \"min_ns\": " << result.minNs << ",\n"
+        << "      \"stddev_ns\": " << result.stddevNs << ",\n"
+        << "      \"mad_ns\": " << result.madNs << ",\n"
+        << "      \"samples_ns\": [";
+    for (size_t s = 0; s < result.samples.size(); s++) {
+      out << (s ? ", " : "") << result.samples[s];
+    }
+    out << "],\n      \"counters\": {";
+    for (size_t c = 0; c < result.counters.size(); c++) {
+      out << (c ? ", " : "") << "\"" << result.counters[c].first
+          << "\": " << result.counters[c].second;
+    }
+    out << "}\n    }";
+  }
+  out << "\n  ]\n}\n";
+}
+
+std::map<std::string, BenchmarkResult> readBaseline(const std::string& path) {
+  std::ifstream in(path);
+  if (!in) {
+    throw std::runtime_error("Cannot read baseline " + path);
+  }
+  std::stringstream buffer;
+  buffer << in.rdbuf();
+  const std::string text = buffer.str();
+
+  // Only needs to understand what writeJson produces: each benchmark has a
+  // "name" followed later by its "samples_ns" array
+  std::map<std::string, BenchmarkResult> results;
+  const std::string nameKey = "\"name\": \"";
+  const std::string samplesKey = "\"samples_ns\": [";
+  for (size_t at = text.find(nameKey); at != std::string::npos;
+       at = text.find(nameKey, at)) {
+    at += nameKey.size();
+    std::string name;
+    for (; at < text.size() && text[at] != '"'; at++) {
+      if (text[at] == '\\' && at + 1 < text.size()) {
+        at++;
+      }
+      name += text[at];
+    }
+    size_t samples = text.find(samplesKey, at);
+    if (samples == std::string::npos) {
+      throw std::runtime_error("No samples_ns for " + name + " in " + path);
+    }
+    BenchmarkResult result;
+    result.name = name;
+    result.iterations = 0;
+    const char* cursor = text.c_str() + samples + samplesKey.size();
+    while (*cursor != ']' && *cursor != '\0') {
+      char* end;
+      result.samples.push_back(std::strtod(cursor, &end));
+      if (end == cursor) {
+        throw std::runtime_error("Bad samples_ns for " + name + " in " +
+                                 path);
+      }
+      cursor = end + std::strspn(end, ", ");
+    }
+    if (result.samples.empty()) {
+      throw std::runtime_error("No samples_ns for " + name + " in " + path);
+    }
+    summarize(result);
+    results[name] = result;
+  }
+  return results;
+}
+
+std::vector<Regression> findRegressions(
+    const std::vector<BenchmarkResult>& results,
+    const std::map<std::string, BenchmarkResult>& baseline, double tolerance,
+    double noise) {
+  std::vector<Regression> regressions;
+  for (const BenchmarkResult& result : results) {
+    auto found = baseline.find(result.name);
+    if (found == baseline.end()) {
+      continue;
+    }
+    const BenchmarkResult& before = found->second;
+    double allowed =
+        before.minNs + std::max(tolerance * before.minNs,
+                                noise * (before.madNs + result.madNs));
+    if (result.minNs > allowed) {
+      regressions.push_back(
+          {result.name, before.minNs, result.minNs, allowed});
+    }
+  }
+  return regressions;
+}
+
+namespace {
+
+const char* kUsage =
+    "Usage: %s [--filter=TEXT] [--repetitions=N] [--min-time=MS]\n"
+    "          [--warmup=MS] [--cpu=N] [--no-counters] [--json=FILE]\n"
+    "          [--baseline=FILE] [--tolerance=FRACTION] [--noise=K]\n"
+    "          [--list]\n";
+
+bool takeValue(const std::string& argument, const std::string& flag,
+               std::string& value) {
+  std::string prefix = flag + "=";
+  if (argument.compare(0, prefix.size(), prefix) != 0) {
+    return false;
+  }
+  value = argument.substr(prefix.size());
+  return true;
+}
+
+}  // namespace
+
+int benchmarkMain(int argc, char* argv[]) {
+  BenchmarkOptions options;
+  std::string jsonPath, baselinePath;
+  double tolerance = 0.10;
+  double noise = 3;
+  bool list = false;
+
+  try {
+    for (int i = 1; i < argc; i++) {
+      std::string argument = argv[i], value;
+      if (takeValue(argument, "--filter", value)) {
+        options.filter = value;
+      } else if (takeValue(argument, "--repetitions", value)) {
+        options.repetitions = std::stoi(value);
+      } else if (takeValue(argument, "--min-time", value)) {
+        options.minTime = std::chrono::milliseconds(std::stol(value));
+      } else if (takeValue(argument, "--warmup", value)) {
+        options.warmup = std::chrono::milliseconds(std::stol(value));
+      } else if (takeValue(argument, "--cpu", value)) {
+        options.cpu = std::stoi(value);
+      } else if (argument == "--no-counters") {
+        options.counters = false;
+      } else if (takeValue(argument, "--json", value)) {
+        jsonPath = value;
+      } else if (takeValue(argument, "--baseline", value)) {
+        baselinePath = value;
+      } else if (takeValue(argument, "--tolerance", value)) {
+        tolerance = std::stod(value);
+      } else if (takeValue(argument, "--noise", value)) {
+        noise = std::stod(value);
+      } else if (argument == "--list") {
+        list = true;
+      } else {
+        std::fprintf(stderr, kUsage, argv[0]);
+        return 2;
+      }
+    }
+  } catch (const std::exception&) {
+    std::fprintf(stderr, kUsage, argv[0]);
+    return 2;
+  }
+
+  if (list) {
+    for (const Registered& benchmark : registry()) {
+      if (benchmark.name.find(options.filter) != std::string::npos) {
+        std::cout << benchmark.name << std::endl;
+      }
+    }
+    return 0;
+  }
+
+  try {
+    // Read the baseline first so a bad path fails before the long run
+    std::map<std::string, BenchmarkResult> baseline;
+    if (!baselinePath.empty()) {
+      baseline = readBaseline(baselinePath);
+    }
+
+    std::vector<BenchmarkResult> results = runBenchmarks(options, std::cout);
+
+    if (!jsonPath.empty()) {
+      std::ofstream out(jsonPath);
+      writeJson(out, results, options);
+      if (!out) {
+        throw std::runtime_error("Cannot write " + jsonPath);
+      }
+    }
+
+    if (baselinePath.empty()) {
+      return 0;
+    }
+    std::vector<Regression> regressions =
+        findRegressions(results, baseline, tolerance, noise);
+    for (const Regression& regression : regressions) {
+      std::cout << "REGRESSION " << regression.name << ": minimum "
+                << regression.baselineNs << " ns -> " << regression.currentNs
+                << " ns (+"
+                << std::lround(100 * (regression.currentNs /
+                                          regression.baselineNs -
+                                      1))
+                << "%, allowed up to " << regression.allowedNs << " ns)"
+                << std::endl;
+    }
+    std::cout << regressions.size() << " regression(s) against "
+              << baselinePath << " with " << tolerance * 100
+              << "% tolerance and " << noise << " x MAD for noise"
+              << std::endl;
+    return regressions.empty() ? 0 : 1;
+  } catch (const std::exception& error) {
+    std::cerr << error.what() << std::endl;
+    return 2;
+  }
+}
@@ -0,0 +1,109 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// A small microbenchmark harness.
+//
+// A benchmark is a function that performs a given number of operations.
+// For each one the harness:
+//   1. Calibrates an iteration count that takes at least minTime.
+//   2. Warms up.
+//   3. Times a number of repetitions.
+//   4. Reports per-operation statistics across those repetitions.
+// Where perf_event_open is allowed, it also reports hardware counters.
+// Results can be written as JSON and compared against an earlier JSON file
+// (the baseline). A benchmark whose fastest repetition got slower by more
+// than the noise of either run allows is a regression.
+
+struct BenchmarkOptions {
+  // Only benchmarks whose name contains this run; empty runs all
+  std::string filter;
+  int repetitions = 10;
+  std::chrono::milliseconds minTime{50};  // Per repetition
+  std::chrono::milliseconds warmup{100};
+  // Pin the process to this CPU; -1 leaves the affinity alone
+  int cpu = -1;
+  bool counters = true;
+};
+
+struct BenchmarkResult {
+  std::string name;
+  uint64_t iterations;  // Operations per repetition
+  std::vector<double> samples;  // Nanoseconds per operation, one per repetition
+  double minNs;
+  double medianNs;
+  double meanNs;
+  double stddevNs;
+  // Median absolute deviation of the samples; unlike stddevNs, a single
+  // interrupted repetition barely moves it
+  double madNs;
+  // Hardware events per operation, e.g. {"cycles", 12.5}; empty when the
+  // counters are unavailable
+  std::vector<std::pair<std::string, double>> counters;
+};
+
+struct Regression {
+  std::string name;
+  double baselineNs;  // Minimum nanoseconds per operation
+  double currentNs;
+  double allowedNs;   // Slowest minimum that would have passed
+};
+
+typedef std::function<void(uint64_t iterations)> BenchmarkBody;
+
+// Adds a benchmark to the global list; body(n) must perform n operations
+void registerBenchmark(const std::string& name, BenchmarkBody body);
+
+std::vector<BenchmarkResult> runBenchmarks(const BenchmarkOptions& options,
+                                           std::ostream& log);
+
+void writeJson(std::ostream& out, const std::vector<BenchmarkResult>& results,
+               const BenchmarkOptions& options);
+
+// Results by benchmark name, from a file written by writeJson, summarized
+// again from their samples; throws std::runtime_error if it cannot be read
+std::map<std::string, BenchmarkResult> readBaseline(const std::string& path);
+
+// Benchmarks whose minimum exceeds the baseline's minimum by more than
+//   max(tolerance * baseline minimum, noise * (baseline MAD + current MAD))
+// The minimum is the repetition least disturbed by the rest of the system,
+// and the MAD term widens the allowance for benchmarks that are noisy on
+// either machine. Benchmarks missing from either side are skipped.
+std::vector<Regression> findRegressions(
+    const std::vector<BenchmarkResult>& results,
+    const std::map<std::string, BenchmarkResult>& baseline, double tolerance,
+    double noise);
+
+// Parses the command line, runs the registered benchmarks and returns the
+// exit status: 0, 1 if there were regressions, 2 on bad usage or errors.
+// See the README for the flags.
+int benchmarkMain(int argc, char* argv[]);
+
+// Makes the compiler assume value is read, so computing it cannot be
+// optimized away
+template <typename T>
+inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "r,m"(value) : "memory");
+#else
+  static const void* volatile sink;
+  sink = &value;
+#endif
+}
+
+// Makes the compiler assume all memory is read and written here
+inline void clobberMemory() {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : : "memory");
+#endif
+}
+
+#endif  // BENCHMARK_H
@@ -0,0 +1,233 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../object_oriented_programming/custom_string/String.h"
+#include "../object_oriented_programming/exercise_4/Vector.h"
+#include "../object_oriented_programming/exercise_5/Stack.h"
+#include "../object_oriented_programming/game_events/GameTimeline.h"
+#include "../object_oriented_programming/game_events/Uuid.h"
+#include "../object_oriented_programming/generic_data_structure/LinkedList.h"
+#include "../object_oriented_programming/grid_based_game/Grid.h"
+#include "../object_oriented_programming/invetory_system/Inventory.h"
+#include "../profiler/Profiler.h"
+#include "Benchmark.h"
+
+// The benchmark suite for the data structures of the exercises. Each body
+// performs `iterations` operations; state that only needs building once is
+// built when the benchmark is registered and captured by the body.
+
+namespace {
+
+// An item whose use() does not print, so Inventory::use measures the
+// lookup rather than the console
+class QuietItem : public Item {
+ public:
+  void use() override { setUsage(getUsage() > 0 ? getUsage() - 1 : 100); }
+};
+
+void registerStacks() {
+  registerBenchmark("Stack<int>/push_pop", [](uint64_t iterations) {
+    Stack<int> stack;
+    for (uint64_t i = 0; i < iterations; i++) {
+      stack.push(int(i));
+      doNotOptimize(stack.pop());
+    }
+  });
+  registerBenchmark("Stack<int,16>/push_pop", [](uint64_t iterations) {
+    Stack<int, 16> stack;
+    for (uint64_t i = 0; i < iterations; i++) {
+      stack.push(int(i));
+      doNotOptimize(stack.pop());
+    }
+  });
+  // Fills to depth 64 and empties again, so the heap-backed stack grows
+  registerBenchmark("Stack<int>/fill_drain_64", [](uint64_t iterations) {
+    for (uint64_t i = 0; i < iterations; i++) {
+      Stack<int> stack;
+      for (int value = 0; value < 64; value++) {
+        stack.push(value);
+      }
+      while (!stack.empty()) {
+        doNotOptimize(stack.pop());
+      }
+    }
+  });
+}
+
+void registerLinkedList() {
+  registerBenchmark("LinkedList<int>/add_remove", [](uint64_t iterations) {
+    LinkedList<int> list;
+    for (uint64_t i = 0; i < iterations; i++) {
+      list.add(int(i));
+      // Otherwise the allocation pair can be optimized out entirely
+      clobberMemory();
+      list.remove();
+    }
+  });
+  auto list = std::make_shared<LinkedList<int>>();
+  for (int value = 0; value < 1000; value++) {
+    list->add(value);
+  }
+  // A missing value walks all 1000 nodes
+  registerBenchmark("LinkedList<int>/search_miss_1000",
+                    [list](uint64_t iterations) {
+                      for (uint64_t i = 0; i < iterations; i++) {
+                        doNotOptimize(list->search(-1));
+                      }
+                    });
+}
+
+void registerString() {
+  registerBenchmark("String/concat", [](uint64_t iterations) {
+    String first = "Hello, ";
+    String second = "world!";
+    for (uint64_t i = 0; i < iterations; i++) {
+      String joined = first + second;
+      doNotOptimize(joined.length());
+    }
+  });
+  registerBenchmark("String/append_32", [](uint64_t iterations) {
+    String piece = "abcdefgh";
+    for (uint64_t i = 0; i < iterations; i++) {
+      String text;
+      for (int part = 0; part < 32; part++) {
+        text += piece;
+      }
+      doNotOptimize(text.length());
+    }
+  });
+  auto text = std::make_shared<String>();
+  for (int part = 0; part < 128; part++) {
+    *text += "lorem ipsum ";
+  }
+  *text += "needle";
+  registerBenchmark("String/find_1k", [text](uint64_t iterations) {
+    String needle = "needle";
+    for (uint64_t i = 0; i < iterations; i++) {
+      doNotOptimize(text->find(needle));
+    }
+  });
+  registerBenchmark("String/substr", [text](uint64_t iterations) {
+    for (uint64_t i = 0; i < iterations; i++) {
+      String part = text->substr(i % 1000, 16);
+      doNotOptimize(part.length());
+    }
+  });
+}
+
+struct TimelineFixture {
+  std::vector<std::unique_ptr<GameEvent<int>>> events;
+  GameTimeline<int> timeline;
+};
+
+void registerTimeline() {
+  // 1000 events spread over 100 time steps, so each query matches 10
+  auto fixture = std::make_shared<TimelineFixture>();
+  for (int i = 0; i < 1000; i++) {
+    fixture->events.emplace_back(new GameEvent<int>("spawn_enemy", i % 100));
+    fixture->timeline.addEvent(fixture->events.back().get());
+  }
+  registerBenchmark("GameTimeline<int>/getEventsAtTime_1000",
+                    [fixture](uint64_t iterations) {
+                      for (uint64_t i = 0; i < iterations; i++) {
+                        doNotOptimize(
+                            fixture->timeline.getEventsAtTime(int(i % 100))
+                                .size());
+                      }
+                    });
+  // Appends at the end and removes again, which scans all 1000 events
+  registerBenchmark("GameTimeline<int>/add_remove_1000",
+                    [fixture](uint64_t iterations) {
+                      GameEvent<int> extra("start_boss_fight", 100);
+                      for (uint64_t i = 0; i < iterations; i++) {
+                        fixture->timeline.addEvent(&extra);
+                        fixture->timeline.removeEvent(&extra);
+                      }
+                    });
+}
+
+struct InventoryFixture {
+  std::vector<QuietItem> items;
+  Inventory inventory;
+};
+
+void registerInventory() {
+  auto fixture = std::make_shared<InventoryFixture>();
+  fixture->items.resize(100);
+  for (QuietItem& item : fixture->items) {
+    fixture->inventory.add(&item);
+  }
+  // use() first checks the item is in the inventory, a linear search
+  registerBenchmark("Inventory/use_100", [fixture](uint64_t iterations) {
+    for (uint64_t i = 0; i < iterations; i++) {
+      fixture->inventory.use(&fixture->items[i % 100]);
+    }
+  });
+}
+
+void registerGrid() {
+  auto grid = std::make_shared<Grid>(100, 100);
+  auto entity = std::make_shared<Entity>(1);
+  for (int row = 0; row < 100; row += 3) {
+    for (int column = 0; column < 100; column += 7) {
+      (*grid)(row, column) = entity;
+    }
+  }
+  registerBenchmark("Grid/access_100x100", [grid](uint64_t iterations) {
+    int row = 0, column = 0;
+    for (uint64_t i = 0; i < iterations; i++) {
+      doNotOptimize((*grid)(row, column).get());
+      if (++column == 100) {
+        column = 0;
+        row = row == 99 ? 0 : row + 1;
+      }
+    }
+  });
+}
+
+void registerVector() {
+  registerBenchmark("Vector/add_scale", [](uint64_t iterations) {
+    Vector position(1.0, 2.0);
+    Vector velocity(0.5, -0.25);
+    for (uint64_t i = 0; i < iterations; i++) {
+      position = position + velocity * 0.016;
+      doNotOptimize(position);
+    }
+  });
+}
+
+void registerUuid() {
+  registerBenchmark("generate_uuid_v4", [](uint64_t iterations) {
+    for (uint64_t i = 0; i < iterations; i++) {
+      doNotOptimize(generate_uuid_v4().size());
+    }
+  });
+}
+
+// Cost of one zone on top of the code it wraps; only in profiling builds
+void registerProfiler() {
+#if defined(GAME_DEV_PROFILE)
+  registerBenchmark("Profiler/empty_zone", [](uint64_t iterations) {
+    for (uint64_t i = 0; i < iterations; i++) {
+      PROFILE_ZONE("empty");
+      clobberMemory();
+    }
+  });
+#endif
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  registerStacks();
+  registerLinkedList();
+  registerString();
+  registerTimeline();
+  registerInventory();
+  registerGrid();
+  registerVector();
+  registerUuid();
+  registerProfiler();
+  return benchmarkMain(argc, argv);
+}
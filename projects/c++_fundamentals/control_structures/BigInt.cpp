@@ -0,0 +1,308 @@
+#include "BigInt.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+typedef BigInt::Limbs Limbs;
+
+namespace {
+
+const uint64_t kBase = BigInt::kBase;
+
+void trimLimbs(Limbs& limbs) {
+  while (!limbs.empty() && limbs.back() == 0) {
+    limbs.pop_back();
+  }
+}
+
+int compareMagnitude(const Limbs& a, const Limbs& b) {
+  if (a.size() != b.size()) {
+    return a.size() < b.size() ? -1 : 1;
+  }
+  for (size_t i = a.size(); i-- > 0;) {
+    if (a[i] != b[i]) {
+      return a[i] < b[i] ? -1 : 1;
+    }
+  }
+  return 0;
+}
+
+// target += value * kBase^shift
+void addShifted(Limbs& target, const uint32_t* value, size_t count,
+                size_t shift) {
+  if (target.size() < shift + count) {
+    target.resize(shift + count, 0);
+  }
+  uint32_t carry = 0;
+  size_t i = 0;
+  for (; i < count; i++) {
+    uint32_t sum = target[shift + i] + value[i] + carry;
+    carry = sum >= kBase;
+    target[shift + i] = carry ? sum - kBase : sum;
+  }
+  for (size_t k = shift + i; carry; k++) {
+    if (k == target.size()) {
+      target.push_back(0);
+    }
+    uint32_t sum = target[k] + carry;
+    carry = sum >= kBase;
+    target[k] = carry ? sum - kBase : sum;
+  }
+}
+
+// target -= value; target must not be smaller than value
+void subtractInPlace(Limbs& target, const Limbs& value) {
+  uint32_t borrow = 0;
+  size_t i = 0;
+  for (; i < value.size(); i++) {
+    int64_t difference = int64_t(target[i]) - value[i] - borrow;
+    borrow = difference < 0;
+    target[i] = uint32_t(borrow ? difference + kBase : difference);
+  }
+  for (; borrow; i++) {
+    borrow = target[i] == 0;
+    target[i] = borrow ? uint32_t(kBase - 1) : target[i] - 1;
+  }
+  trimLimbs(target);
+}
+
+Limbs addMagnitudes(const uint32_t* a, size_t an, const uint32_t* b,
+                    size_t bn) {
+  Limbs sum(a, a + an);
+  addShifted(sum, b, bn, 0);
+  return sum;
+}
+
+Limbs schoolbook(const uint32_t* a, size_t an, const uint32_t* b, size_t bn) {
+  Limbs product(an + bn, 0);
+  for (size_t i = 0; i < an; i++) {
+    uint64_t digit = a[i];
+    if (digit == 0) {
+      continue;
+    }
+    // digit * b[j] < 10^18 and the two additions keep every step far below
+    // 2^64
+    uint64_t carry = 0;
+    for (size_t j = 0; j < bn; j++) {
+      uint64_t current = product[i + j] + digit * b[j] + carry;
+      product[i + j] = uint32_t(current % kBase);
+      carry = current / kBase;
+    }
+    for (size_t k = i + bn; carry; k++) {
+      uint64_t current = product[k] + carry;
+      product[k] = uint32_t(current % kBase);
+      carry = current / kBase;
+    }
+  }
+  trimLimbs(product);
+  return product;
+}
+
+Limbs karatsuba(const uint32_t* a, size_t an, const uint32_t* b, size_t bn) {
+  while (an > 0 && a[an - 1] == 0) an--;
+  while (bn > 0 && b[bn - 1] == 0) bn--;
+  if (an < bn) {
+    std::swap(a, b);
+    std::swap(an, bn);
+  }
+  if (bn == 0) {
+    return Limbs();
+  }
+  if (bn < BigInt::kKaratsubaThreshold) {
+    return schoolbook(a, an, b, bn);
+  }
+
+  size_t half = an / 2;
+  if (bn <= half) {
+    // Lopsided: split only the longer operand, a = high * B^half + low
+    Limbs product = karatsuba(a, half, b, bn);
+    Limbs high = karatsuba(a + half, an - half, b, bn);
+    addShifted(product, high.data(), high.size(), half);
+    trimLimbs(product);
+    return product;
+  }
+
+  // (a1 B + a0)(b1 B + b0) = z2 B^2 + ((a0 + a1)(b0 + b1) - z2 - z0) B + z0
+  Limbs z0 = karatsuba(a, half, b, half);
+  Limbs z2 = karatsuba(a + half, an - half, b + half, bn - half);
+  Limbs aSum = addMagnitudes(a, half, a + half, an - half);
+  Limbs bSum = addMagnitudes(b, half, b + half, bn - half);
+  Limbs z1 = karatsuba(aSum.data(), aSum.size(), bSum.data(), bSum.size());
+  subtractInPlace(z1, z0);
+  subtractInPlace(z1, z2);
+
+  Limbs product = z0;
+  product.reserve(an + bn + 1);
+  addShifted(product, z1.data(), z1.size(), half);
+  addShifted(product, z2.data(), z2.size(), 2 * half);
+  trimLimbs(product);
+  return product;
+}
+
+}  // namespace
+
+BigInt::BigInt(long long value) : negative(value < 0) {
+  unsigned long long magnitude =
+      negative ? 0ULL - static_cast<unsigned long long>(value) : value;
+  while (magnitude > 0) {
+    limbs.push_back(uint32_t(magnitude % kBase));
+    magnitude /= kBase;
+  }
+}
+
+BigInt::BigInt(const std::string& decimal) : negative(false) {
+  size_t start = 0;
+  if (!decimal.empty() && decimal[0] == '-') {
+    start = 1;
+  }
+  if (start == decimal.size()) {
+    throw std::invalid_argument("Not a decimal integer: \"" + decimal + "\"");
+  }
+  for (size_t i = start; i < decimal.size(); i++) {
+    if (decimal[i] < '0' || decimal[i] > '9') {
+      throw std::invalid_argument("Not a decimal integer: \"" + decimal +
+                                  "\"");
+    }
+  }
+  // Nine digits per limb, starting from the least significant end
+  for (size_t end = decimal.size(); end > start;) {
+    size_t begin = end > start + kDigitsPerLimb ? end - kDigitsPerLimb : start;
+    limbs.push_back(uint32_t(std::stoul(decimal.substr(begin, end - begin))));
+    end = begin;
+  }
+  trim();
+  negative = start == 1 && !limbs.empty();
+}
+
+void BigInt::trim() {
+  trimLimbs(limbs);
+  if (limbs.empty()) {
+    negative = false;
+  }
+}
+
+BigInt BigInt::fromMagnitude(Limbs limbs, bool negative) {
+  BigInt result;
+  result.limbs = std::move(limbs);
+  result.negative = negative;
+  result.trim();
+  return result;
+}
+
+size_t BigInt::digitCount() const {
+  if (limbs.empty()) {
+    return 1;
+  }
+  size_t digits = (limbs.size() - 1) * kDigitsPerLimb;
+  for (uint32_t top = limbs.back(); top > 0; top /= 10) {
+    digits++;
+  }
+  return digits;
+}
+
+std::string BigInt::toString() const {
+  if (limbs.empty()) {
+    return "0";
+  }
+  std::string text = negative ? "-" : "";
+  text += std::to_string(limbs.back());
+  size_t position = text.size();
+  text.resize(position + (limbs.size() - 1) * kDigitsPerLimb);
+  // Every lower limb is exactly nine digits, zero padded
+  for (size_t i = limbs.size() - 1; i-- > 0;) {
+    uint32_t limb = limbs[i];
+    for (int digit = kDigitsPerLimb - 1; digit >= 0; digit--) {
+      text[position + digit] = char('0' + limb % 10);
+      limb /= 10;
+    }
+    position += kDigitsPerLimb;
+  }
+  return text;
+}
+
+BigInt BigInt::operator-() const {
+  BigInt result = *this;
+  result.negative = !negative && !limbs.empty();
+  return result;
+}
+
+BigInt& BigInt::operator+=(const BigInt& rhs) {
+  if (negative == rhs.negative) {
+    addShifted(limbs, rhs.limbs.data(), rhs.limbs.size(), 0);
+    return *this;
+  }
+  // Opposite signs: subtract the smaller magnitude from the larger
+  if (compareMagnitude(limbs, rhs.limbs) >= 0) {
+    subtractInPlace(limbs, rhs.limbs);
+  } else {
+    Limbs larger = rhs.limbs;
+    subtractInPlace(larger, limbs);
+    limbs.swap(larger);
+    negative = rhs.negative;
+  }
+  trim();
+  return *this;
+}
+
+BigInt& BigInt::operator-=(const BigInt& rhs) {
+  if (this == &rhs) {
+    *this = BigInt();
+    return *this;
+  }
+  negative = !negative;
+  *this += rhs;
+  negative = !negative && !limbs.empty();
+  return *this;
+}
+
+BigInt& BigInt::operator*=(const BigInt& rhs) { return *this = *this * rhs; }
+
+BigInt& BigInt::operator*=(uint32_t factor) {
+  if (factor >= kBase) {
+    return *this *= BigInt(static_cast<long long>(factor));
+  }
+  uint64_t carry = 0;
+  for (uint32_t& limb : limbs) {
+    uint64_t current = uint64_t(limb) * factor + carry;
+    limb = uint32_t(current % kBase);
+    carry = current / kBase;
+  }
+  if (carry > 0) {
+    limbs.push_back(uint32_t(carry));
+  }
+  trim();
+  return *this;
+}
+
+BigInt& BigInt::operator*=(int factor) {
+  *this *= uint32_t(factor < 0 ? -int64_t(factor) : factor);
+  if (factor < 0 && !limbs.empty()) {
+    negative = !negative;
+  }
+  return *this;
+}
+
+BigInt operator*(const BigInt& lhs, const BigInt& rhs) {
+  return BigInt::fromMagnitude(
+      karatsuba(lhs.limbs.data(), lhs.limbs.size(), rhs.limbs.data(),
+                rhs.limbs.size()),
+      lhs.negative != rhs.negative);
+}
+
+BigInt BigInt::multiplySchoolbook(const BigInt& lhs, const BigInt& rhs) {
+  return fromMagnitude(schoolbook(lhs.limbs.data(), lhs.limbs.size(),
+                                  rhs.limbs.data(), rhs.limbs.size()),
+                       lhs.negative != rhs.negative);
+}
+
+bool operator<(const BigInt& lhs, const BigInt& rhs) {
+  if (lhs.negative != rhs.negative) {
+    return lhs.negative;
+  }
+  int order = compareMagnitude(lhs.limbs, rhs.limbs);
+  return lhs.negative ? order > 0 : order < 0;
+}
+
+std::ostream& operator<<(std::ostream& out, const BigInt& value) {
+  return out << value.toString();
+}
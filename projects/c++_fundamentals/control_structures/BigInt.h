@@ -0,0 +1,87 @@
+#ifndef BIG_INT_H
+#define BIG_INT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// Arbitrary-precision signed integer.
+//
+// The magnitude is stored as base 10^9 limbs, least significant first, so
+// printing is a straight copy of nine digits per limb. Multiplication
+// switches from the schoolbook method to Karatsuba once both operands are
+// long enough for it to pay off.
+class BigInt {
+ public:
+  typedef std::vector<uint32_t> Limbs;
+
+  static const uint32_t kBase = 1000000000;
+  static const int kDigitsPerLimb = 9;
+  // Operands shorter than this (in limbs) use schoolbook multiplication
+  static const size_t kKaratsubaThreshold = 48;
+
+  BigInt() : negative(false) {}
+  BigInt(long long value);
+  // Decimal digits with an optional leading '-'; throws
+  // std::invalid_argument on anything else
+  explicit BigInt(const std::string& decimal);
+
+  bool isZero() const { return limbs.empty(); }
+  bool isNegative() const { return negative; }
+  // Number of decimal digits in the magnitude (1 for zero)
+  size_t digitCount() const;
+  std::string toString() const;
+
+  BigInt operator-() const;
+  BigInt& operator+=(const BigInt& rhs);
+  BigInt& operator-=(const BigInt& rhs);
+  BigInt& operator*=(const BigInt& rhs);
+  // Multiplies in place by a small factor, which is much cheaper than a
+  // full multiplication
+  BigInt& operator*=(uint32_t factor);
+  // Same for a signed factor. Without it, x *= -1 would pick the unsigned
+  // overload and multiply by 4294967295.
+  BigInt& operator*=(int factor);
+
+  friend BigInt operator+(BigInt lhs, const BigInt& rhs) { return lhs += rhs; }
+  friend BigInt operator-(BigInt lhs, const BigInt& rhs) { return lhs -= rhs; }
+  friend BigInt operator*(const BigInt& lhs, const BigInt& rhs);
+
+  friend bool operator==(const BigInt& lhs, const BigInt& rhs) {
+    return lhs.negative == rhs.negative && lhs.limbs == rhs.limbs;
+  }
+  friend bool operator!=(const BigInt& lhs, const BigInt& rhs) {
+    return !(lhs == rhs);
+  }
+  friend bool operator<(const BigInt& lhs, const BigInt& rhs);
+  friend bool operator>(const BigInt& lhs, const BigInt& rhs) {
+    return rhs < lhs;
+  }
+  friend bool operator<=(const BigInt& lhs, const BigInt& rhs) {
+    return !(rhs < lhs);
+  }
+  friend bool operator>=(const BigInt& lhs, const BigInt& rhs) {
+    return !(lhs < rhs);
+  }
+
+  friend std::ostream& operator<<(std::ostream& out, const BigInt& value);
+
+  // Lowest limb, i.e. the magnitude modulo 10^9
+  uint32_t lowLimb() const { return limbs.empty() ? 0 : limbs[0]; }
+  const Limbs& magnitude() const { return limbs; }
+
+  // Same result as operator*, always with the schoolbook method; for
+  // measuring what Karatsuba saves
+  static BigInt multiplySchoolbook(const BigInt& lhs, const BigInt& rhs);
+
+ private:
+  Limbs limbs;
+  bool negative;
+
+  void trim();
+  static BigInt fromMagnitude(Limbs limbs, bool negative);
+};
+
+#endif  // BIG_INT_H
@@ -0,0 +1,145 @@
+#include "Factorial.h"
+
+#include <mutex>
+
+namespace {
+
+// Factorials below this come from the memo table
+const unsigned kMemoLimit = 512;
+
+BigInt productRange(const std::vector<uint32_t>& factors, size_t begin,
+                    size_t end) {
+  if (end - begin <= 16) {
+    // Pack factors into limb-sized chunks before touching the BigInt
+    BigInt product = 1;
+    uint64_t chunk = 1;
+    for (size_t i = begin; i < end; i++) {
+      if (chunk * factors[i] >= BigInt::kBase) {
+        product *= uint32_t(chunk);
+        chunk = 1;
+      }
+      chunk *= factors[i];
+    }
+    if (chunk >= BigInt::kBase) {
+      product *= BigInt(static_cast<long long>(chunk));
+    } else {
+      product *= uint32_t(chunk);
+    }
+    return product;
+  }
+  size_t middle = begin + (end - begin) / 2;
+  return productRange(factors, begin, middle) *
+         productRange(factors, middle, end);
+}
+
+// swing(n) = n! / ((n/2)!)^2 as a product of prime powers. The exponent
+// of p is the number of odd terms in n/p, n/p^2, n/p^3, ...
+BigInt swing(unsigned n, const std::vector<uint32_t>& primes) {
+  std::vector<uint32_t> factors;
+  for (uint32_t p : primes) {
+    if (p > n) {
+      break;
+    }
+    uint32_t power = 1;
+    for (unsigned q = n / p; q > 0; q /= p) {
+      if (q & 1) {
+        power *= p;
+      }
+    }
+    if (power > 1) {
+      factors.push_back(power);
+    }
+  }
+  return productOf(factors);
+}
+
+BigInt primeSwingFactorial(unsigned n, const std::vector<uint32_t>& primes);
+
+std::mutex memoMutex;
+std::vector<BigInt> memo;
+
+BigInt memoFactorial(unsigned n) {
+  std::lock_guard<std::mutex> lock(memoMutex);
+  if (memo.empty()) {
+    memo.push_back(1);
+  }
+  while (memo.size() <= n) {
+    BigInt next = memo.back();
+    next *= uint32_t(memo.size());
+    memo.push_back(std::move(next));
+  }
+  return memo[n];
+}
+
+BigInt primeSwingFactorial(unsigned n, const std::vector<uint32_t>& primes) {
+  if (n < kMemoLimit) {
+    return memoFactorial(n);
+  }
+  BigInt half = primeSwingFactorial(n / 2, primes);
+  return half * half * swing(n, primes);
+}
+
+}  // namespace
+
+std::vector<uint32_t> primesUpTo(unsigned limit) {
+  std::vector<uint32_t> primes;
+  if (limit < 2) {
+    return primes;
+  }
+  std::vector<bool> composite(limit + 1, false);
+  for (uint64_t i = 2; i <= limit; i++) {
+    if (composite[i]) {
+      continue;
+    }
+    primes.push_back(uint32_t(i));
+    for (uint64_t multiple = i * i; multiple <= limit; multiple += i) {
+      composite[multiple] = true;
+    }
+  }
+  return primes;
+}
+
+BigInt productOf(const std::vector<uint32_t>& factors) {
+  if (factors.empty()) {
+    return 1;
+  }
+  return productRange(factors, 0, factors.size());
+}
+
+BigInt factorial(unsigned n) {
+  if (n < kMemoLimit) {
+    return memoFactorial(n);
+  }
+  return primeSwingFactorial(n, primesUpTo(n));
+}
+
+BigInt factorialProductTree(unsigned n) {
+  std::vector<uint32_t> factors;
+  for (unsigned i = 2; i <= n; i++) {
+    factors.push_back(i);
+  }
+  return productOf(factors);
+}
+
+BigInt binomial(unsigned n, unsigned k) {
+  if (k > n) {
+    return 0;
+  }
+  std::vector<uint32_t> factors;
+  for (uint32_t p : primesUpTo(n)) {
+    // Legendre: the exponent of p in n! is n/p + n/p^2 + ...
+    unsigned exponent = 0;
+    for (uint64_t power = p; power <= n; power *= p) {
+      exponent += n / power - k / power - (n - k) / power;
+    }
+    // By Kummer's theorem p^exponent <= n, so each power fits in 32 bits
+    uint32_t factor = 1;
+    for (unsigned e = 0; e < exponent; e++) {
+      factor *= p;
+    }
+    if (factor > 1) {
+      factors.push_back(factor);
+    }
+  }
+  return productOf(factors);
+}
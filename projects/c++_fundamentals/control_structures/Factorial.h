@@ -0,0 +1,45 @@
+#ifndef FACTORIAL_H
+#define FACTORIAL_H
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "BigInt.h"
+#include "LookupTables.h"
+
+// Largest n whose factorial fits in 64 bits
+const unsigned kMaxFactorial64 = 20;
+
+static_assert(kFactorialTable.size() == kMaxFactorial64 + 1, "");
+
+// n! for n <= kMaxFactorial64, from the compile-time table; throws
+// std::out_of_range beyond that
+inline uint64_t factorial64(unsigned n) {
+  if (n > kMaxFactorial64) {
+    throw std::out_of_range(std::to_string(n) + "! does not fit in 64 bits");
+  }
+  return kFactorialTable[n];
+}
+
+// n! with the prime-swing algorithm: n! = ((n/2)!)^2 * swing(n), where the
+// swing number is assembled from its prime factorization. Results for
+// small n come from a memo table that is filled on first use.
+BigInt factorial(unsigned n);
+
+// n! as 1 * 2 * ... * n multiplied pairwise in a balanced tree (binary
+// splitting), so most multiplications are between numbers of similar size
+BigInt factorialProductTree(unsigned n);
+
+// n choose k from its prime factorization (Legendre's formula), without
+// computing any factorial
+BigInt binomial(unsigned n, unsigned k);
+
+// Every prime <= limit, by the sieve of Eratosthenes
+std::vector<uint32_t> primesUpTo(unsigned limit);
+
+// Product of the given factors, multiplied as a balanced tree
+BigInt productOf(const std::vector<uint32_t>& factors);
+
+#endif  // FACTORIAL_H
@@ -0,0 +1,43 @@
+#include "Fibonacci.h"
+
+std::pair<BigInt, BigInt> fibonacciPair(uint64_t n) {
+  BigInt current = 0, next = 1;  // F(k), F(k + 1) with k = 0
+  int bit = 63;
+  while (bit >= 0 && !((n >> bit) & 1)) {
+    bit--;
+  }
+  for (; bit >= 0; bit--) {
+    // k -> 2k
+    BigInt twiceNext = next;
+    twiceNext *= 2u;
+    BigInt doubled = current * (twiceNext - current);
+    BigInt doubledNext = current * current + next * next;
+    if ((n >> bit) & 1) {
+      // 2k -> 2k + 1
+      current = std::move(doubledNext);
+      next = doubled + current;
+    } else {
+      current = std::move(doubled);
+      next = std::move(doubledNext);
+    }
+  }
+  return std::make_pair(std::move(current), std::move(next));
+}
+
+BigInt fibonacci(uint64_t n) { return fibonacciPair(n).first; }
+
+void writeFibonacciSeries(std::ostream& out, uint64_t count) {
+  if (count == 0) {
+    return;
+  }
+  BigInt current = 0, next = 1;
+  for (uint64_t i = 0; i < count; i++) {
+    if (i > 0) {
+      out << ' ';
+    }
+    out << current;
+    current += next;
+    std::swap(current, next);
+  }
+  out << '\n';
+}
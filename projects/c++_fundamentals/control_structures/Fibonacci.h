@@ -0,0 +1,41 @@
+#ifndef FIBONACCI_H
+#define FIBONACCI_H
+
+#include <cstdint>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "BigInt.h"
+#include "LookupTables.h"
+
+// Largest n whose Fibonacci number fits in 64 bits
+const unsigned kMaxFibonacci64 = 93;
+
+static_assert(kFibonacciTable.size() == kMaxFibonacci64 + 1, "");
+
+// F(n) for n <= kMaxFibonacci64, from the compile-time table; throws
+// std::out_of_range beyond that
+inline uint64_t fibonacci64(unsigned n) {
+  if (n > kMaxFibonacci64) {
+    throw std::out_of_range("F(" + std::to_string(n) +
+                            ") does not fit in 64 bits");
+  }
+  return kFibonacciTable[n];
+}
+
+// F(n) by fast doubling: O(log n) big-integer multiplications, using
+//   F(2k)     = F(k) * (2 F(k+1) - F(k))
+//   F(2k + 1) = F(k)^2 + F(k+1)^2
+BigInt fibonacci(uint64_t n);
+
+// F(n) and F(n + 1) together
+std::pair<BigInt, BigInt> fibonacciPair(uint64_t n);
+
+// Writes F(0) .. F(count - 1) separated by spaces, then a newline. Terms
+// are built by addition and handed to the stream without flushing; the
+// caller decides when to flush.
+void writeFibonacciSeries(std::ostream& out, uint64_t count);
+
+#endif  // FIBONACCI_H
@@ -0,0 +1,106 @@
+#ifndef LOOKUP_TABLES_H
+#define LOOKUP_TABLES_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+// Every factorial and Fibonacci number that fits in 64 bits, generated at
+// compile time. Looking one up is a single load; the loops they replace
+// stay below as the reference the tables are checked against.
+
+// n! by multiplying 1..n; the reference for kFactorialTable
+constexpr uint64_t factorialLoop(unsigned n) {
+  uint64_t result = 1;
+  for (unsigned i = 2; i <= n; i++) {
+    result *= i;
+  }
+  return result;
+}
+
+// F(n) by repeated addition; the reference for kFibonacciTable
+constexpr uint64_t fibonacciLoop(unsigned n) {
+  uint64_t current = 0, next = 1;
+  for (unsigned i = 0; i < n; i++) {
+    uint64_t sum = current + next;
+    current = next;
+    next = sum;
+  }
+  return current;
+}
+
+// Number of factorials (0!, 1!, ...) that fit in 64 bits
+constexpr size_t countFactorials64() {
+  uint64_t value = 1;
+  size_t count = 1;
+  while (value <= std::numeric_limits<uint64_t>::max() / count) {
+    value *= count;
+    count++;
+  }
+  return count;
+}
+
+// Number of Fibonacci numbers (F(0), F(1), ...) that fit in 64 bits
+constexpr size_t countFibonacci64() {
+  uint64_t previous = 0, current = 1;
+  size_t count = 2;
+  while (current <= std::numeric_limits<uint64_t>::max() - previous) {
+    uint64_t sum = previous + current;
+    previous = current;
+    current = sum;
+    count++;
+  }
+  return count;
+}
+
+constexpr std::array<uint64_t, countFactorials64()> makeFactorialTable() {
+  std::array<uint64_t, countFactorials64()> table = {};
+  table[0] = 1;
+  for (size_t i = 1; i < table.size(); i++) {
+    table[i] = table[i - 1] * i;
+  }
+  return table;
+}
+
+constexpr std::array<uint64_t, countFibonacci64()> makeFibonacciTable() {
+  std::array<uint64_t, countFibonacci64()> table = {};
+  table[1] = 1;
+  for (size_t i = 2; i < table.size(); i++) {
+    table[i] = table[i - 1] + table[i - 2];
+  }
+  return table;
+}
+
+inline constexpr std::array<uint64_t, countFactorials64()> kFactorialTable =
+    makeFactorialTable();
+inline constexpr std::array<uint64_t, countFibonacci64()> kFibonacciTable =
+    makeFibonacciTable();
+
+// True if every entry equals what the loop computes for that index
+template <size_t N>
+constexpr bool tableMatches(const std::array<uint64_t, N>& table,
+                            uint64_t (*reference)(unsigned)) {
+  for (size_t i = 0; i < N; i++) {
+    if (table[i] != reference(unsigned(i))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static_assert(tableMatches(kFactorialTable, factorialLoop),
+              "Factorial table disagrees with factorialLoop");
+static_assert(tableMatches(kFibonacciTable, fibonacciLoop),
+              "Fibonacci table disagrees with fibonacciLoop");
+// The tables stop exactly where the next value would overflow
+static_assert(kFactorialTable.size() == 21 &&
+                  kFactorialTable.back() >
+                      std::numeric_limits<uint64_t>::max() / 21,
+              "Factorial table should end at 20!");
+static_assert(kFibonacciTable.size() == 94 &&
+                  kFibonacciTable[93] > std::numeric_limits<uint64_t>::max() -
+                                            kFibonacciTable[92],
+              "Fibonacci table should end at F(93)");
+
+#endif  // LOOKUP_TABLES_H
@@ -1,25 +1,25 @@
 #include <iostream>
 
+#include "BigInt.h"
+#include "Factorial.h"
+
 using std::cin;
 using std::cout;
 using std::endl;
 
-int getFactorial(int number) {
-  int result = 1;
-
-  for (int i = number; i > 0; i--) {
-    result *= i;
-  }
-  return result;
-}
+BigInt getFactorial(int number) { return factorial(number); }
 
 void printFactorial(int number) {
   cout << number << "!";
 
+  // Multiply while writing out the expansion instead of computing the
+  // product a second time afterwards
+  BigInt result = 1;
   if (number > 1) {
     cout << " = ";
     for (int i = number; i > 0; i--) {
       cout << i;
+      result *= uint32_t(i);
       if (i != 1) {
         cout << " x ";
       }
@@ -27,13 +27,18 @@ void printFactorial(int number) {
   }
 
   cout << " = ";
-  cout << getFactorial(number) << endl;
+  cout << result << endl;
 }
 
 int main() {
-  for (int i = 0; i <= 10; i++) {
+  // An int overflows at 13!, so the products are BigInts
+  for (int i = 0; i <= 25; i++) {
     printFactorial(i);
   }
 
+  cout << endl;
+  cout << "100! = " << getFactorial(100) << endl;
+  cout << "C(100, 50) = " << binomial(100, 50) << endl;
+
   return 0;
 }
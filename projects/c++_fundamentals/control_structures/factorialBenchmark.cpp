@@ -0,0 +1,95 @@
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+
+#include "BigInt.h"
+#include "Factorial.h"
+
+using std::cout;
+using std::endl;
+
+// Times n! computed three ways: multiplying 1..n in order, multiplying them
+// as a balanced product tree, and the prime-swing algorithm. Also checks
+// binomial() against factorials.
+//
+// Build: g++ -std=c++17 -O2 factorialBenchmark.cpp Factorial.cpp BigInt.cpp
+// Usage: factorialBenchmark [largest n]
+
+namespace {
+
+double millisecondsFor(const std::function<void()>& run) {
+  auto start = std::chrono::steady_clock::now();
+  run();
+  std::chrono::duration<double, std::milli> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return elapsed.count();
+}
+
+BigInt sequentialFactorial(unsigned n) {
+  BigInt result = 1;
+  for (unsigned i = 2; i <= n; i++) {
+    result *= uint32_t(i);
+  }
+  return result;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  unsigned largest = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+  // The sequential product is quadratic; past this it only wastes time
+  const unsigned kSequentialLimit = 100000;
+
+  for (unsigned i = 0; i <= kMaxFactorial64; i++) {
+    if (factorial(i) != BigInt(static_cast<long long>(factorial64(i)))) {
+      cout << "factorial64(" << i << ") is wrong" << endl;
+      return 1;
+    }
+  }
+
+  cout << std::setw(9) << "n" << std::setw(10) << "digits" << std::setw(14)
+       << "sequential" << std::setw(14) << "tree" << std::setw(14) << "swing"
+       << endl;
+  cout << std::fixed << std::setprecision(2);
+
+  for (unsigned n = 10; n <= largest; n *= 10) {
+    BigInt swing, tree, sequential;
+    double swingMs = millisecondsFor([&] { swing = factorial(n); });
+    double treeMs = millisecondsFor([&] { tree = factorialProductTree(n); });
+    if (tree != swing) {
+      cout << "Product tree and prime swing disagree for " << n << "!" << endl;
+      return 1;
+    }
+
+    cout << std::setw(9) << n << std::setw(10) << swing.digitCount();
+    if (n <= kSequentialLimit) {
+      double sequentialMs =
+          millisecondsFor([&] { sequential = sequentialFactorial(n); });
+      if (sequential != swing) {
+        cout << endl << "Sequential product disagrees for " << n << "!" << endl;
+        return 1;
+      }
+      cout << std::setw(11) << sequentialMs << " ms";
+    } else {
+      cout << std::setw(14) << "-";
+    }
+    cout << std::setw(11) << treeMs << " ms" << std::setw(11) << swingMs
+         << " ms" << endl;
+  }
+
+  // C(n, k) * k! * (n - k)! must equal n!
+  const unsigned n = 20000, k = 7000;
+  BigInt choose;
+  double binomialMs = millisecondsFor([&] { choose = binomial(n, k); });
+  if (choose * factorial(k) * factorial(n - k) != factorial(n)) {
+    cout << "binomial(" << n << ", " << k << ") is wrong" << endl;
+    return 1;
+  }
+  cout << endl
+       << "C(" << n << ", " << k << "): " << choose.digitCount() << " digits in "
+       << binomialMs << " ms" << endl;
+
+  return 0;
+}
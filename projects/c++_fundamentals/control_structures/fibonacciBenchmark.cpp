@@ -0,0 +1,101 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "BigInt.h"
+#include "Fibonacci.h"
+
+using std::cout;
+using std::endl;
+
+template <typename Function>
+double milliseconds(Function run) {
+  auto begin = std::chrono::steady_clock::now();
+  run();
+  return std::chrono::duration<double, std::milli>(
+             std::chrono::steady_clock::now() - begin)
+      .count();
+}
+
+// F(n) mod 10^9 the slow, obviously correct way
+uint32_t fibonacciModBillion(uint64_t n) {
+  uint64_t current = 0, next = 1;
+  for (uint64_t i = 0; i < n; i++) {
+    uint64_t sum = (current + next) % BigInt::kBase;
+    current = next;
+    next = sum;
+  }
+  return uint32_t(current);
+}
+
+// Usage: fibonacciBenchmark [largest n]
+int main(int argc, char* argv[]) {
+  uint64_t largest = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+  cout << std::fixed << std::setprecision(2);
+
+  cout << std::setw(10) << "n" << std::setw(10) << "digits" << std::setw(18)
+       << "fast doubling ms" << std::setw(16) << "iterative ms"
+       << std::setw(10) << "check" << endl;
+  bool allGood = true;
+  for (uint64_t n = 1000; n <= largest; n *= 10) {
+    BigInt fast;
+    double fastMs = milliseconds([&]() { fast = fibonacci(n); });
+
+    // Repeated addition is O(n^2) digit work; only run it while it is quick
+    std::string iterativeMs = "-";
+    bool same = fast.lowLimb() == fibonacciModBillion(n);
+    if (n <= 100000) {
+      BigInt current = 0, next = 1;
+      double ms = milliseconds([&]() {
+        for (uint64_t i = 0; i < n; i++) {
+          current += next;
+          std::swap(current, next);
+        }
+      });
+      std::ostringstream formatted;
+      formatted << std::fixed << std::setprecision(2) << ms;
+      iterativeMs = formatted.str();
+      same = same && current == fast;
+    }
+    allGood = allGood && same;
+    cout << std::setw(10) << n << std::setw(10) << fast.digitCount()
+         << std::setw(18) << fastMs << std::setw(16) << iterativeMs
+         << std::setw(10) << (same ? "ok" : "WRONG") << endl;
+  }
+
+  // The multiplication at the heart of the last doubling step
+  BigInt operand = fibonacci(largest / 2);
+  BigInt karatsubaProduct, schoolbookProduct;
+  double karatsubaMs =
+      milliseconds([&]() { karatsubaProduct = operand * operand; });
+  double schoolbookMs = milliseconds([&]() {
+    schoolbookProduct = BigInt::multiplySchoolbook(operand, operand);
+  });
+  allGood = allGood && karatsubaProduct == schoolbookProduct;
+  cout << endl
+       << "Squaring a " << operand.digitCount() << "-digit number: Karatsuba "
+       << karatsubaMs << " ms, schoolbook " << schoolbookMs << " ms" << endl;
+
+  // Printing a series: a flush per term against one stream write per term
+  const uint64_t kTerms = 20000;
+  std::ofstream sink("/dev/null");
+  double endlMs = milliseconds([&]() {
+    BigInt current = 0, next = 1;
+    for (uint64_t i = 0; i < kTerms; i++) {
+      sink << current << endl;
+      current += next;
+      std::swap(current, next);
+    }
+  });
+  double streamedMs =
+      milliseconds([&]() { writeFibonacciSeries(sink, kTerms); });
+  cout << "First " << kTerms << " terms to /dev/null: endl per term "
+       << endlMs << " ms, streamed " << streamedMs << " ms" << endl;
+
+  return allGood ? 0 : 1;
+}
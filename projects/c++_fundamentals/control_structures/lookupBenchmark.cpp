@@ -0,0 +1,92 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "../functions_and_recursion/PowerTable.h"
+#include "LookupTables.h"
+
+using std::cout;
+using std::endl;
+
+// Compares the compile-time tables with the loops and exponentiation by
+// squaring they replace, on random in-range arguments so neither side can
+// be folded away.
+//
+// Build: g++ -std=c++17 -O2 lookupBenchmark.cpp
+// Usage: lookupBenchmark [calls per measurement]
+
+namespace {
+
+template <typename Run>
+double nanosecondsPerCall(const std::vector<unsigned>& arguments, Run run) {
+  auto start = std::chrono::steady_clock::now();
+  uint64_t sink = 0;
+  for (unsigned argument : arguments) {
+    sink += run(argument);
+  }
+  std::chrono::duration<double, std::nano> elapsed =
+      std::chrono::steady_clock::now() - start;
+  volatile uint64_t keep = sink;
+  (void)keep;
+  return elapsed.count() / arguments.size();
+}
+
+std::vector<unsigned> randomArguments(size_t count, unsigned limit) {
+  std::mt19937 random(7);
+  std::uniform_int_distribution<unsigned> pick(0, limit - 1);
+  std::vector<unsigned> arguments(count);
+  for (unsigned& argument : arguments) {
+    argument = pick(random);
+  }
+  return arguments;
+}
+
+void report(const char* name, double computed, double table) {
+  cout << std::setw(14) << name << std::setw(12) << computed << std::setw(12)
+       << table << endl;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  size_t calls = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10000000;
+  cout << std::fixed << std::setprecision(2);
+  cout << std::setw(14) << "ns per call" << std::setw(12) << "computed"
+       << std::setw(12) << "table" << endl;
+
+  std::vector<unsigned> factorials =
+      randomArguments(calls, kFactorialTable.size());
+  report("factorial",
+         nanosecondsPerCall(factorials, [](unsigned n) {
+           return factorialLoop(n);
+         }),
+         nanosecondsPerCall(factorials, [](unsigned n) {
+           return kFactorialTable[n];
+         }));
+
+  std::vector<unsigned> fibonacci =
+      randomArguments(calls, kFibonacciTable.size());
+  report("fibonacci",
+         nanosecondsPerCall(fibonacci, [](unsigned n) {
+           return fibonacciLoop(n);
+         }),
+         nanosecondsPerCall(fibonacci, [](unsigned n) {
+           return kFibonacciTable[n];
+         }));
+
+  // Powers of 3: exponents 0..40
+  std::vector<unsigned> exponents =
+      randomArguments(calls, PowerTable<3>::size);
+  report("3^n",
+         nanosecondsPerCall(exponents, [](unsigned n) {
+           return checkedPower<uint64_t>(3, n);
+         }),
+         nanosecondsPerCall(exponents, [](unsigned n) {
+           return power64(3, n);
+         }));
+  return 0;
+}
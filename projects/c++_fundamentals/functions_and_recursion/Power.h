@@ -0,0 +1,235 @@
+#ifndef POWER_H
+#define POWER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+// Exponentiation by squaring: base^exponent in O(log exponent)
+// multiplications instead of exponent of them. Everything here is
+// constexpr, so powers of constants cost nothing at run time.
+//
+// The modular and Montgomery code needs unsigned __int128 (GCC and Clang).
+
+__extension__ typedef unsigned __int128 uint128_t;
+
+// base^exponent for any arithmetic type. Floating-point bases accept a
+// negative exponent and return the reciprocal; for integers that throws
+// std::domain_error. Unsigned integers wrap; signed overflow is undefined,
+// as with any other multiplication, so use checkedPower when it can happen.
+template <typename T>
+constexpr T power(T base, long long exponent = 2) {
+  static_assert(std::is_arithmetic<T>::value,
+                "power needs an arithmetic type; matrices have an overload");
+  bool reciprocal = exponent < 0;
+  if (reciprocal) {
+    if (!std::is_floating_point<T>::value) {
+      throw std::domain_error("Negative exponent for an integer power");
+    }
+    exponent = -exponent;
+  }
+  T result = 1;
+  while (exponent > 0) {
+    if (exponent & 1) {
+      result *= base;
+    }
+    exponent >>= 1;
+    if (exponent > 0) {
+      base *= base;
+    }
+  }
+  return reciprocal ? T(1) / result : result;
+}
+
+// base^exponent for an integer type, throwing std::overflow_error instead
+// of wrapping when the result does not fit in T
+template <typename T>
+constexpr T checkedPower(T base, unsigned long long exponent) {
+  static_assert(std::is_integral<T>::value, "checkedPower needs integers");
+  T result = 1;
+  while (exponent > 0) {
+    if ((exponent & 1) && __builtin_mul_overflow(result, base, &result)) {
+      throw std::overflow_error("Integer power overflows");
+    }
+    exponent >>= 1;
+    // Only square when a later bit needs it; the last square could
+    // overflow even though the result fits
+    if (exponent > 0 && __builtin_mul_overflow(base, base, &base)) {
+      throw std::overflow_error("Integer power overflows");
+    }
+  }
+  return result;
+}
+
+// Arithmetic modulo an odd 64-bit number in Montgomery form: a is stored as
+// a * 2^64 mod n, which turns the division in every modular multiplication
+// into two multiplications and a subtraction.
+class Montgomery64 {
+ public:
+  constexpr explicit Montgomery64(uint64_t modulus)
+      : n(modulus), inverse(0), r2(0) {
+    if (modulus % 2 == 0) {
+      throw std::invalid_argument("Montgomery modulus must be odd");
+    }
+    // Newton's iteration doubles the correct low bits each step; n is its
+    // own inverse modulo 8, so five steps give all 64
+    uint64_t x = n;
+    for (int i = 0; i < 5; i++) {
+      x *= 2 - n * x;
+    }
+    inverse = x;
+    // 2^64 mod n, then squared
+    uint64_t r = (0 - n) % n;
+    r2 = uint64_t((uint128_t)r * r % n);
+  }
+
+  constexpr uint64_t modulus() const { return n; }
+
+  constexpr uint64_t toMontgomery(uint64_t a) const {
+    return multiply(a % n, r2);
+  }
+  constexpr uint64_t fromMontgomery(uint64_t a) const { return reduce(a); }
+
+  // Product of two values in Montgomery form, also in Montgomery form
+  constexpr uint64_t multiply(uint64_t a, uint64_t b) const {
+    return reduce((uint128_t)a * b);
+  }
+
+  // base^exponent mod n for a plain (not Montgomery) base
+  constexpr uint64_t power(uint64_t base, unsigned long long exponent) const {
+    uint64_t result = toMontgomery(1);
+    base = toMontgomery(base);
+    while (exponent > 0) {
+      if (exponent & 1) {
+        result = multiply(result, base);
+      }
+      exponent >>= 1;
+      if (exponent > 0) {
+        base = multiply(base, base);
+      }
+    }
+    return fromMontgomery(result);
+  }
+
+ private:
+  uint64_t n;
+  uint64_t inverse;  // n^-1 mod 2^64
+  uint64_t r2;       // 2^128 mod n
+
+  // t * 2^-64 mod n for t < n * 2^64. m is chosen so that t and m * n agree
+  // in the low 64 bits, so their difference is exact in the high half.
+  constexpr uint64_t reduce(uint128_t t) const {
+    uint64_t m = uint64_t(t) * inverse;
+    uint64_t high = uint64_t(t >> 64);
+    uint64_t subtract = uint64_t(((uint128_t)m * n) >> 64);
+    return high >= subtract ? high - subtract : high - subtract + n;
+  }
+};
+
+// base^exponent mod modulus. Odd moduli go through Montgomery form; even
+// ones fall back to a 128-bit remainder per multiplication.
+constexpr uint64_t powerMod(uint64_t base, unsigned long long exponent,
+                            uint64_t modulus) {
+  if (modulus == 0) {
+    throw std::domain_error("powerMod by zero");
+  }
+  if (modulus % 2 == 1) {
+    return Montgomery64(modulus).power(base, exponent);
+  }
+  uint64_t result = 1 % modulus;
+  base %= modulus;
+  while (exponent > 0) {
+    if (exponent & 1) {
+      result = uint64_t((uint128_t)result * base % modulus);
+    }
+    exponent >>= 1;
+    if (exponent > 0) {
+      base = uint64_t((uint128_t)base * base % modulus);
+    }
+  }
+  return result;
+}
+
+// Square matrix with constexpr arithmetic, for jumping ahead in linear
+// recurrences by raising their companion matrix to a power
+template <typename T, size_t N>
+struct Matrix {
+  T cells[N][N] = {};
+
+  static constexpr Matrix identity() {
+    Matrix result;
+    for (size_t i = 0; i < N; i++) {
+      result.cells[i][i] = 1;
+    }
+    return result;
+  }
+
+  friend constexpr Matrix operator*(const Matrix& lhs, const Matrix& rhs) {
+    Matrix product;
+    for (size_t i = 0; i < N; i++) {
+      for (size_t k = 0; k < N; k++) {
+        for (size_t j = 0; j < N; j++) {
+          product.cells[i][j] += lhs.cells[i][k] * rhs.cells[k][j];
+        }
+      }
+    }
+    return product;
+  }
+
+  constexpr Matrix& operator*=(const Matrix& rhs) {
+    return *this = *this * rhs;
+  }
+};
+
+template <typename T, size_t N>
+constexpr Matrix<T, N> power(Matrix<T, N> base, long long exponent) {
+  if (exponent < 0) {
+    throw std::domain_error("Negative exponent for a matrix power");
+  }
+  Matrix<T, N> result = Matrix<T, N>::identity();
+  while (exponent > 0) {
+    if (exponent & 1) {
+      result *= base;
+    }
+    exponent >>= 1;
+    if (exponent > 0) {
+      base *= base;
+    }
+  }
+  return result;
+}
+
+// Term n of x(k) = c[0] x(k-1) + c[1] x(k-2) + ... + c[N-1] x(k-N), given
+// x(0) .. x(N-1), in O(N^3 log n). Arithmetic wraps modulo 2^64.
+template <size_t N>
+constexpr uint64_t linearRecurrence(const uint64_t (&coefficients)[N],
+                                    const uint64_t (&initial)[N],
+                                    unsigned long long n) {
+  if (n < N) {
+    return initial[n];
+  }
+  // Companion matrix: maps (x(k-1), ..., x(k-N)) to (x(k), ..., x(k-N+1))
+  Matrix<uint64_t, N> step;
+  for (size_t j = 0; j < N; j++) {
+    step.cells[0][j] = coefficients[j];
+  }
+  for (size_t i = 1; i < N; i++) {
+    step.cells[i][i - 1] = 1;
+  }
+  Matrix<uint64_t, N> jump = power(step, n - (N - 1));
+  uint64_t term = 0;
+  for (size_t j = 0; j < N; j++) {
+    term += jump.cells[0][j] * initial[N - 1 - j];
+  }
+  return term;
+}
+
+// Fibonacci number n modulo 2^64 (exact up to n = 93)
+constexpr uint64_t fibonacciByMatrix(unsigned long long n) {
+  const uint64_t coefficients[2] = {1, 1};
+  const uint64_t initial[2] = {0, 1};
+  return linearRecurrence(coefficients, initial, n);
+}
+
+#endif  // POWER_H
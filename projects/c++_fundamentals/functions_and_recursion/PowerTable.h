@@ -0,0 +1,100 @@
+#ifndef POWER_TABLE_H
+#define POWER_TABLE_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include "Power.h"
+
+// Every power of a small base that fits in 64 bits, generated at compile
+// time, so power64 on those bases is a bounds check and a load.
+
+// Bases 2..kMaxTableBase get a table
+const uint64_t kMaxTableBase = 16;
+
+// Number of powers base^0, base^1, ... that fit in 64 bits
+constexpr size_t countPowers64(uint64_t base) {
+  uint64_t value = 1;
+  size_t count = 1;
+  while (value <= std::numeric_limits<uint64_t>::max() / base) {
+    value *= base;
+    count++;
+  }
+  return count;
+}
+
+template <uint64_t Base>
+struct PowerTable {
+  static_assert(Base >= 2, "Powers of 0 and 1 need no table");
+  static constexpr size_t size = countPowers64(Base);
+
+  static constexpr std::array<uint64_t, size> make() {
+    std::array<uint64_t, size> table = {};
+    table[0] = 1;
+    for (size_t i = 1; i < size; i++) {
+      table[i] = table[i - 1] * Base;
+    }
+    return table;
+  }
+
+  static constexpr std::array<uint64_t, size> values = make();
+
+  // Checks every entry against checkedPower, and that the next power
+  // would overflow
+  static constexpr bool verify() {
+    for (size_t i = 0; i < size; i++) {
+      if (values[i] != checkedPower<uint64_t>(Base, i)) {
+        return false;
+      }
+    }
+    return values[size - 1] > std::numeric_limits<uint64_t>::max() / Base;
+  }
+  static_assert(verify(), "Power table disagrees with checkedPower");
+};
+
+namespace powerTableDetail {
+
+struct TableView {
+  const uint64_t* values;
+  size_t size;
+};
+
+template <size_t... Offsets>
+constexpr std::array<TableView, sizeof...(Offsets)> makeViews(
+    std::index_sequence<Offsets...>) {
+  return {{{PowerTable<Offsets + 2>::values.data(),
+            PowerTable<Offsets + 2>::size}...}};
+}
+
+// Entry i is the table for base i + 2
+inline constexpr std::array<TableView, kMaxTableBase - 1> kViews =
+    makeViews(std::make_index_sequence<kMaxTableBase - 1>());
+
+}  // namespace powerTableDetail
+
+// base^exponent, throwing std::overflow_error if it does not fit in 64
+// bits. Bases up to kMaxTableBase come from the tables; larger ones are
+// computed with checkedPower.
+constexpr uint64_t power64(uint64_t base, unsigned exponent) {
+  if (base < 2 || base > kMaxTableBase) {
+    return checkedPower<uint64_t>(base, exponent);
+  }
+  const powerTableDetail::TableView& table =
+      powerTableDetail::kViews[base - 2];
+  if (exponent >= table.size) {
+    throw std::overflow_error("Integer power overflows");
+  }
+  return table.values[exponent];
+}
+
+static_assert(PowerTable<2>::size == 64 && PowerTable<10>::size == 20 &&
+                  PowerTable<16>::size == 16,
+              "Unexpected power table sizes");
+static_assert(power64(3, 40) == checkedPower<uint64_t>(3, 40), "");
+static_assert(power64(17, 15) == checkedPower<uint64_t>(17, 15), "");
+
+#endif  // POWER_TABLE_H
@@ -1,18 +1,27 @@
 #include <iostream>
 
+#include "Power.h"
+
 using std::cout;
 using std::endl;
 
-void power(int base, int exponent = 2) {
-  int result = 1;
-  for (int i = 1; i <= exponent; i++) {
-    result *= base;
-  }
-  cout << result << endl;
-}
+// power(base, exponent = 2) lives in Power.h, where it squares instead of
+// looping once per exponent step
+static_assert(power(2, 10) == 1024, "power is evaluated at compile time");
 
 int main() {
-  power(2, 4);
-  power(2, 0);
+  cout << power(2, 4) << endl;
+  cout << power(2, 0) << endl;
+  // The exponent defaults to 2
+  cout << power(7) << endl;
+  cout << power(2.0, -3) << endl;
+
+  cout << "3^40 mod 1000000007 = " << powerMod(3, 40, 1000000007) << endl;
+  cout << "F(90) = " << fibonacciByMatrix(90) << endl;
+  try {
+    checkedPower<int>(10, 10);
+  } catch (const std::overflow_error& error) {
+    cout << "10^10 as an int: " << error.what() << endl;
+  }
   return 0;
-}
\ No newline at end of file
+}
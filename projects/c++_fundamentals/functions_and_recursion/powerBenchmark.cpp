@@ -0,0 +1,158 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "Power.h"
+
+using std::cout;
+using std::endl;
+
+// Times exponentiation by squaring against the one-multiplication-per-step
+// loop the exercise started with, for wrapping 64-bit integers and for
+// powers modulo a large prime (plain 128-bit remainders vs Montgomery form).
+// Also cross-checks the implementations against each other.
+//
+// Build: g++ -std=c++17 -O2 powerBenchmark.cpp
+// Usage: powerBenchmark [calls per measurement]
+
+namespace {
+
+uint64_t linearPower(uint64_t base, unsigned long long exponent) {
+  uint64_t result = 1;
+  for (unsigned long long i = 0; i < exponent; i++) {
+    result *= base;
+  }
+  return result;
+}
+
+uint64_t linearPowerMod(uint64_t base, unsigned long long exponent,
+                        uint64_t modulus) {
+  uint64_t result = 1 % modulus;
+  for (unsigned long long i = 0; i < exponent; i++) {
+    result = uint64_t((uint128_t)result * base % modulus);
+  }
+  return result;
+}
+
+uint64_t squaringPowerMod(uint64_t base, unsigned long long exponent,
+                          uint64_t modulus) {
+  uint64_t result = 1 % modulus;
+  base %= modulus;
+  while (exponent > 0) {
+    if (exponent & 1) {
+      result = uint64_t((uint128_t)result * base % modulus);
+    }
+    exponent >>= 1;
+    base = uint64_t((uint128_t)base * base % modulus);
+  }
+  return result;
+}
+
+template <typename Run>
+double nanosecondsPerCall(size_t calls, Run run) {
+  auto start = std::chrono::steady_clock::now();
+  uint64_t sink = 0;
+  for (size_t i = 0; i < calls; i++) {
+    sink += run(i);
+  }
+  std::chrono::duration<double, std::nano> elapsed =
+      std::chrono::steady_clock::now() - start;
+  // Keeps the results alive so the loop cannot be dropped
+  volatile uint64_t keep = sink;
+  (void)keep;
+  return elapsed.count() / calls;
+}
+
+// Compile-time checks of the constexpr paths
+static_assert(power(3, 4) == 81, "");
+static_assert(power(2.0, -2) == 0.25, "");
+static_assert(checkedPower<int64_t>(3, 39) == 4052555153018976267LL, "");
+static_assert(powerMod(2, 10, 1000) == 24, "");
+static_assert(powerMod(3, 200, 1000000007) ==
+                  Montgomery64(1000000007).power(3, 200),
+              "");
+static_assert(fibonacciByMatrix(93) == 12200160415121876738ULL, "");
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  size_t calls = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+  std::mt19937_64 random(42);
+  std::vector<uint64_t> bases(1024);
+  for (uint64_t& base : bases) {
+    base = random();
+  }
+
+  // Montgomery against plain remainders, including moduli near 2^64
+  const uint64_t moduli[] = {3, 1000000007, (1ULL << 61) - 1,
+                             18446744073709551557ULL, 18446744073709551615ULL};
+  for (uint64_t modulus : moduli) {
+    Montgomery64 field(modulus);
+    for (int i = 0; i < 1000; i++) {
+      uint64_t base = random();
+      uint64_t exponent = random();
+      if (field.power(base, exponent) !=
+          squaringPowerMod(base, exponent, modulus)) {
+        cout << "Montgomery power disagrees modulo " << modulus << endl;
+        return 1;
+      }
+    }
+  }
+  for (unsigned n = 0; n <= 93; n++) {
+    uint64_t a = 0, b = 1;
+    for (unsigned i = 0; i < n; i++) {
+      uint64_t next = a + b;
+      a = b;
+      b = next;
+    }
+    if (fibonacciByMatrix(n) != a) {
+      cout << "fibonacciByMatrix(" << n << ") is wrong" << endl;
+      return 1;
+    }
+  }
+
+  cout << std::fixed << std::setprecision(1);
+  cout << "uint64_t power (ns per call)" << endl;
+  cout << std::setw(12) << "exponent" << std::setw(12) << "linear"
+       << std::setw(12) << "squaring" << endl;
+  for (unsigned long long exponent : {5ULL, 30ULL, 1000ULL, 100000ULL}) {
+    size_t runs = exponent > 1000 ? calls / 1000 : calls;
+    double linear = nanosecondsPerCall(runs, [&](size_t i) {
+      return linearPower(bases[i & 1023], exponent);
+    });
+    double squaring = nanosecondsPerCall(runs, [&](size_t i) {
+      return power<uint64_t>(bases[i & 1023], exponent);
+    });
+    cout << std::setw(12) << exponent << std::setw(12) << linear
+         << std::setw(12) << squaring << endl;
+  }
+
+  const unsigned long long prime = (1ULL << 61) - 1;
+  Montgomery64 field(prime);
+  cout << endl << "Power modulo 2^61 - 1 (ns per call)" << endl;
+  cout << std::setw(12) << "exponent" << std::setw(12) << "linear"
+       << std::setw(12) << "squaring" << std::setw(12) << "montgomery"
+       << endl;
+  for (unsigned long long exponent : {1000ULL, prime - 2}) {
+    bool linearFeasible = exponent <= 1000;
+    cout << std::setw(12) << (exponent == prime - 2 ? "p - 2" : "1000");
+    if (linearFeasible) {
+      cout << std::setw(12) << nanosecondsPerCall(calls / 100, [&](size_t i) {
+        return linearPowerMod(bases[i & 1023], exponent, prime);
+      });
+    } else {
+      cout << std::setw(12) << "-";
+    }
+    cout << std::setw(12) << nanosecondsPerCall(calls, [&](size_t i) {
+      return squaringPowerMod(bases[i & 1023], exponent, prime);
+    });
+    cout << std::setw(12) << nanosecondsPerCall(calls, [&](size_t i) {
+      return field.power(bases[i & 1023], exponent);
+    }) << endl;
+  }
+  return 0;
+}
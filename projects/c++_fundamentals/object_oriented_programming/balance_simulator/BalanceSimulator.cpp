@@ -0,0 +1,162 @@
+#include "BalanceSimulator.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+#include "Philox.h"
+
+namespace {
+
+// Duels a thread claims at a time: enough to make the shared counter cheap,
+// few enough that threads finish close together
+const uint64_t kBlockDuels = 1024;
+// Philox streams per duel: the duel's own, then one per character
+const uint64_t kStreamsPerDuel = 3;
+
+void duel(const Balance& balance, const Matchup& matchup, uint64_t seed,
+          uint64_t index, MatchupStats& stats) {
+  uint64_t stream = index * kStreamsPerDuel;
+  Philox4x32 random(seed, stream);
+  std::unique_ptr<Character> sides[2] = {
+      makeCharacter(matchup.first, "first", seed, stream + 1, balance),
+      makeCharacter(matchup.second, "second", seed, stream + 2, balance)};
+  int startingHealth[2] = {sides[0]->getHealth(), sides[1]->getHealth()};
+
+  int attacker = int(random() & 1);
+  int winner = -1;
+  int rounds = 0;
+  while (winner < 0 && rounds < kMaxDuelRounds) {
+    rounds++;
+    for (int turn = 0; turn < 2; turn++) {
+      Character& defender = *sides[1 - attacker];
+      sides[attacker]->attack(defender);
+      if (defender.getHealth() <= 0) {
+        winner = attacker;
+        break;
+      }
+      attacker = 1 - attacker;
+    }
+  }
+
+  stats.duels++;
+  stats.rounds += uint64_t(rounds);
+  (winner < 0 ? stats.draws : stats.wins[winner])++;
+  for (int side = 0; side < 2; side++) {
+    int dealt = startingHealth[1 - side] - sides[1 - side]->getHealth();
+    stats.damageDealt[side] += uint64_t(dealt);
+    stats.damage[side][std::min(dealt / 10, kDamageBuckets - 1)]++;
+  }
+}
+
+}  // namespace
+
+std::vector<Matchup> allMatchups() {
+  const CharacterClass classes[] = {CharacterClass::Warrior,
+                                    CharacterClass::Mage,
+                                    CharacterClass::Archer};
+  std::vector<Matchup> matchups;
+  for (int i = 0; i < 3; i++) {
+    for (int j = i; j < 3; j++) {
+      matchups.push_back({classes[i], classes[j]});
+    }
+  }
+  return matchups;
+}
+
+MatchupStats& MatchupStats::operator+=(const MatchupStats& other) {
+  duels += other.duels;
+  draws += other.draws;
+  rounds += other.rounds;
+  for (int side = 0; side < 2; side++) {
+    wins[side] += other.wins[side];
+    damageDealt[side] += other.damageDealt[side];
+    for (int bucket = 0; bucket < kDamageBuckets; bucket++) {
+      damage[side][bucket] += other.damage[side][bucket];
+    }
+  }
+  return *this;
+}
+
+bool MatchupStats::operator==(const MatchupStats& other) const {
+  for (int side = 0; side < 2; side++) {
+    if (wins[side] != other.wins[side] ||
+        damageDealt[side] != other.damageDealt[side] ||
+        damage[side] != other.damage[side]) {
+      return false;
+    }
+  }
+  return duels == other.duels && draws == other.draws &&
+         rounds == other.rounds;
+}
+
+BalanceReport simulateBalance(const Balance& balance,
+                              const std::vector<Matchup>& matchups,
+                              uint64_t duelsPerMatchup, uint64_t seed,
+                              int threads) {
+  if (balance.mageCriticalDivisor < 1 || balance.archerDamageDivisor < 1) {
+    throw std::invalid_argument("Balance divisors must be at least 1");
+  }
+  if (threads <= 0) {
+    threads = int(std::max(1u, std::thread::hardware_concurrency()));
+  }
+
+  uint64_t total = matchups.size() * duelsPerMatchup;
+  std::atomic<uint64_t> nextDuel(0);
+  std::vector<std::vector<MatchupStats>> perThread(
+      threads, std::vector<MatchupStats>(matchups.size()));
+
+  auto worker = [&](std::vector<MatchupStats>& stats) {
+    // Characters report every attack. The setting is per thread, which is
+    // also why the calling thread does not take a share of the duels.
+    Character::setLog(nullptr);
+    for (;;) {
+      uint64_t begin = nextDuel.fetch_add(kBlockDuels);
+      if (begin >= total) {
+        return;
+      }
+      uint64_t end = std::min(total, begin + kBlockDuels);
+      for (uint64_t index = begin; index < end; index++) {
+        size_t matchup = size_t(index / duelsPerMatchup);
+        duel(balance, matchups[matchup], seed, index, stats[matchup]);
+      }
+    }
+  };
+
+  auto start = std::chrono::steady_clock::now();
+  std::vector<std::thread> pool;
+  for (int t = 0; t < threads; t++) {
+    pool.emplace_back(worker, std::ref(perThread[t]));
+  }
+  for (std::thread& thread : pool) {
+    thread.join();
+  }
+
+  BalanceReport report;
+  report.seconds = std::chrono::duration<double>(
+                       std::chrono::steady_clock::now() - start)
+                       .count();
+  report.matchups.resize(matchups.size());
+  for (const std::vector<MatchupStats>& stats : perThread) {
+    for (size_t m = 0; m < matchups.size(); m++) {
+      report.matchups[m] += stats[m];
+    }
+  }
+  return report;
+}
+
+const char* className(CharacterClass type) {
+  switch (type) {
+    case CharacterClass::Warrior:
+      return "Warrior";
+    case CharacterClass::Mage:
+      return "Mage";
+    case CharacterClass::Archer:
+      return "Archer";
+  }
+  return "Unknown";
+}
@@ -0,0 +1,63 @@
+#ifndef BALANCE_SIMULATOR_H
+#define BALANCE_SIMULATOR_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Replay.h"
+
+// Monte-Carlo duels between the character classes, for checking what a
+// Balance does before anyone plays it.
+//
+// A duel pits two freshly created characters against each other. They take
+// turns attacking, the one going first picked at random, until one has no
+// health left or kMaxDuelRounds rounds have passed, which is a draw. Every
+// random number of duel i comes from Philox streams 3i to 3i + 2, keyed by
+// the seed: who strikes first from the first, and each character's
+// strength and attacks from its own. No two duels share a stream. The
+// totals are integer counts, so the same seed gives the same results with
+// any number of threads.
+
+const int kMaxDuelRounds = 100;
+// Damage histograms have buckets of 10 health; the last one is 100 and more
+const int kDamageBuckets = 11;
+
+struct Matchup {
+  CharacterClass first;
+  CharacterClass second;
+};
+
+// Every pairing of Warrior, Mage and Archer, mirror matches included
+std::vector<Matchup> allMatchups();
+
+struct MatchupStats {
+  uint64_t duels = 0;
+  uint64_t wins[2] = {0, 0};  // By first and second
+  uint64_t draws = 0;
+  uint64_t rounds = 0;         // Summed over all duels
+  uint64_t damageDealt[2] = {0, 0};
+  // damage[side][bucket]: duels in which that side dealt that much damage
+  std::array<uint64_t, kDamageBuckets> damage[2] = {};
+
+  MatchupStats& operator+=(const MatchupStats& other);
+  bool operator==(const MatchupStats& other) const;
+};
+
+struct BalanceReport {
+  std::vector<MatchupStats> matchups;  // In the order they were given
+  double seconds;
+};
+
+// Runs duelsPerMatchup duels of each matchup on the given number of threads
+// (all hardware threads if 0). Throws std::invalid_argument for a Balance
+// with a divisor below 1.
+BalanceReport simulateBalance(const Balance& balance,
+                              const std::vector<Matchup>& matchups,
+                              uint64_t duelsPerMatchup, uint64_t seed,
+                              int threads = 0);
+
+const char* className(CharacterClass type);
+
+#endif  // BALANCE_SIMULATOR_H
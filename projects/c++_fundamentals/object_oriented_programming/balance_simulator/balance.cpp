@@ -0,0 +1,134 @@
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "BalanceSimulator.h"
+
+using std::cout;
+using std::endl;
+
+// Win rates and damage for every matchup under a Balance.
+//
+// Usage: balance [duels per matchup] [seed] [setting=value]...
+// where setting is warriorDamagePercent, mageCriticalDivisor, archerQuiver
+// or archerDamageDivisor, e.g. balance 1000000 1 archerQuiver=5
+
+struct Setting {
+  const char* name;
+  int Balance::*value;
+};
+
+const Setting kSettings[] = {
+    {"warriorDamagePercent", &Balance::warriorDamagePercent},
+    {"mageCriticalDivisor", &Balance::mageCriticalDivisor},
+    {"archerQuiver", &Balance::archerQuiver},
+    {"archerDamageDivisor", &Balance::archerDamageDivisor}};
+
+bool parseSetting(const char* argument, Balance& balance) {
+  const char* equals = std::strchr(argument, '=');
+  if (equals == nullptr) {
+    return false;
+  }
+  std::string name(argument, equals);
+  for (const Setting& setting : kSettings) {
+    if (name == setting.name) {
+      balance.*setting.value = std::atoi(equals + 1);
+      return true;
+    }
+  }
+  return false;
+}
+
+std::string percent(uint64_t part, uint64_t whole) {
+  std::ostringstream out;
+  out << std::fixed << std::setprecision(1)
+      << (whole ? 100.0 * part / whole : 0) << "%";
+  return out.str();
+}
+
+int main(int argc, char* argv[]) {
+  uint64_t duels = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100000;
+  uint64_t seed = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1;
+  Balance balance;
+  for (int i = 3; i < argc; i++) {
+    if (!parseSetting(argv[i], balance)) {
+      std::cerr << "Unknown setting " << argv[i] << endl;
+      return 1;
+    }
+  }
+
+  std::vector<Matchup> matchups = allMatchups();
+  BalanceReport report = simulateBalance(balance, matchups, duels, seed);
+
+  cout << "Balance:";
+  for (const Setting& setting : kSettings) {
+    cout << " " << setting.name << "=" << balance.*setting.value;
+  }
+  cout << endl
+       << duels * matchups.size() << " duels in " << std::fixed
+       << std::setprecision(2) << report.seconds << " s, "
+       << std::setprecision(0) << duels * matchups.size() / report.seconds
+       << " duels/s" << endl
+       << endl;
+
+  cout << std::left << std::setw(20) << "matchup" << std::right
+       << std::setw(10) << "1st wins" << std::setw(10) << "2nd wins"
+       << std::setw(8) << "draws" << std::setw(8) << "rounds" << std::setw(11)
+       << "1st damage" << std::setw(11) << "2nd damage" << endl;
+  uint64_t classWins[4] = {}, classDuels[4] = {};
+  for (size_t m = 0; m < matchups.size(); m++) {
+    const MatchupStats& stats = report.matchups[m];
+    CharacterClass sides[2] = {matchups[m].first, matchups[m].second};
+    std::string label = std::string(className(sides[0])) + " v " +
+                        className(sides[1]);
+    cout << std::left << std::setw(20) << label << std::right
+         << std::setw(10) << percent(stats.wins[0], stats.duels)
+         << std::setw(10) << percent(stats.wins[1], stats.duels)
+         << std::setw(8) << percent(stats.draws, stats.duels)
+         << std::setprecision(1) << std::setw(8)
+         << double(stats.rounds) / stats.duels << std::setw(11)
+         << double(stats.damageDealt[0]) / stats.duels << std::setw(11)
+         << double(stats.damageDealt[1]) / stats.duels << endl;
+    for (int side = 0; side < 2; side++) {
+      classWins[int(sides[side])] += stats.wins[side];
+      classDuels[int(sides[side])] += stats.duels;
+    }
+  }
+
+  cout << endl << "Win rate over all duels:";
+  for (CharacterClass type : {CharacterClass::Warrior, CharacterClass::Mage,
+                              CharacterClass::Archer}) {
+    cout << " " << className(type) << " "
+         << percent(classWins[int(type)], classDuels[int(type)]);
+  }
+  cout << endl << endl;
+
+  cout << "Damage dealt in a duel, share of duels per bucket of 10" << endl
+       << std::left << std::setw(28) << "" << std::right;
+  for (int bucket = 0; bucket < kDamageBuckets; bucket++) {
+    cout << std::setw(6)
+         << (bucket + 1 < kDamageBuckets ? std::to_string(bucket * 10)
+                                         : std::to_string(bucket * 10) + "+");
+  }
+  cout << endl;
+  for (size_t m = 0; m < matchups.size(); m++) {
+    const MatchupStats& stats = report.matchups[m];
+    CharacterClass sides[2] = {matchups[m].first, matchups[m].second};
+    for (int side = 0; side < 2; side++) {
+      std::string label = std::string(side == 0 ? "1st " : "2nd ") +
+                          className(sides[side]) + " v " +
+                          className(sides[1 - side]);
+      cout << std::left << std::setw(28) << label << std::right;
+      for (uint64_t count : stats.damage[side]) {
+        cout << std::setw(6) << std::setprecision(0)
+             << 100.0 * count / stats.duels;
+      }
+      cout << endl;
+    }
+  }
+  return 0;
+}
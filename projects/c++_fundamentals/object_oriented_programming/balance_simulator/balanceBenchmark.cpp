@@ -0,0 +1,123 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "BalanceSimulator.h"
+#include "Philox.h"
+
+using std::cout;
+using std::endl;
+
+// Duels per second against the number of threads, and a check that every
+// thread count gives exactly the results of one thread. Exits 1 before
+// that if Philox4x32 does not reproduce the reference vectors.
+//
+// Usage: balanceBenchmark [duels per matchup] [max threads]
+
+const uint64_t kSeed = 2024;
+const int kStreams = 1000000;
+
+struct KnownAnswer {
+  Philox4x32::Block counter;
+  std::array<uint32_t, 2> key;
+  Philox4x32::Block expected;
+};
+
+// philox4x32_10 vectors from the Random123 distribution (kat_vectors).
+// Replays and the simulator's results depend on these exact numbers.
+const KnownAnswer kKnownAnswers[] = {
+    {{0, 0, 0, 0}, {0, 0}, {0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}},
+    {{0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+     {0xffffffff, 0xffffffff},
+     {0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}},
+    {{0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344},
+     {0xa4093822, 0x299f31d0},
+     {0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}}};
+
+bool philoxMatchesKnownAnswers() {
+  for (const KnownAnswer& answer : kKnownAnswers) {
+    if (Philox4x32::generate(answer.counter, answer.key) != answer.expected) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Setting up a fresh random stream and drawing the three numbers a duel
+// needs, with each engine
+template <typename MakeEngine>
+double nanosecondsPerStream(MakeEngine make) {
+  uint32_t sink = 0;
+  auto begin = std::chrono::steady_clock::now();
+  for (int i = 0; i < kStreams; i++) {
+    auto engine = make(i);
+    sink ^= engine() ^ engine() ^ engine();
+  }
+  double seconds = std::chrono::duration<double>(
+                       std::chrono::steady_clock::now() - begin)
+                       .count();
+  // Keeps the loop from being optimized away
+  if (sink == 1) {
+    cout << "";
+  }
+  return seconds * 1e9 / kStreams;
+}
+
+int main(int argc, char* argv[]) {
+  uint64_t duels = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 50000;
+  int maxThreads = argc > 2 ? std::atoi(argv[2])
+                            : int(std::thread::hardware_concurrency());
+  maxThreads = std::max(1, maxThreads);
+
+  if (!philoxMatchesKnownAnswers()) {
+    cout << "Philox4x32 does not match the Random123 known answers" << endl;
+    return 1;
+  }
+  cout << "Philox4x32 matches the Random123 known answers" << endl;
+
+  cout << std::fixed << std::setprecision(1) << "New stream and 3 draws: "
+       << "Philox4x32 "
+       << nanosecondsPerStream([](int i) { return Philox4x32(kSeed, i); })
+       << " ns, std::mt19937 "
+       << nanosecondsPerStream([](int i) { return std::mt19937(i); })
+       << " ns" << endl;
+
+  std::vector<int> threadCounts;
+  for (int t = 1; t < maxThreads; t *= 2) {
+    threadCounts.push_back(t);
+  }
+  threadCounts.push_back(maxThreads);
+
+  std::vector<Matchup> matchups = allMatchups();
+  uint64_t total = duels * matchups.size();
+  cout << total << " duels per run" << endl;
+  cout << std::setw(9) << "threads" << std::setw(14) << "duels/s"
+       << std::setw(10) << "speedup" << std::setw(12) << "results" << endl;
+
+  bool allSame = true;
+  std::vector<MatchupStats> baseline;
+  double baselineSeconds = 0;
+  for (int threads : threadCounts) {
+    BalanceReport report =
+        simulateBalance(Balance(), matchups, duels, kSeed, threads);
+    bool same = true;
+    if (baseline.empty()) {
+      baseline = report.matchups;
+      baselineSeconds = report.seconds;
+    } else {
+      same = report.matchups == baseline;
+    }
+    allSame = allSame && same;
+    cout << std::setw(9) << threads << std::setw(14) << std::setprecision(0)
+         << total / report.seconds << std::setw(10) << std::setprecision(2)
+         << baselineSeconds / report.seconds << std::setw(12)
+         << (same ? "same" : "DIFFERENT") << endl;
+  }
+  return allSame ? 0 : 1;
+}
@@ -2,36 +2,50 @@
 
 #include <chrono>
 #include <iostream>
-#include <random>
 
-using std::cout;
 using std::endl;
 
-// Function to generate random strength
-int generateRandomStrength(int min_strength, int max_strength) {
-  // Obtain a seed from the system clock:
-  unsigned seed = std::chrono::system_clock::now().time_since_epoch().count();
+namespace {
 
-  // Using Mersenne Twister algorithm to generate random numbers
-  std::mt19937 generator(seed);
+// Per thread, so threads silencing their characters do not share a stream
+thread_local std::ostream* logStream = &std::cout;
+// Has no buffer, so it is always failed and formats nothing
+thread_local std::ostream silentStream(nullptr);
 
-  // Using a distribution to transform the random values generated by the
-  // Mersenne Twister into an integer range [min_strength, max_strength]
-  std::uniform_int_distribution<int> distribution(min_strength, max_strength);
-
-  // Generate a random strength
-  return distribution(generator);
+uint32_t clockSeed() {
+  return static_cast<uint32_t>(
+      std::chrono::system_clock::now().time_since_epoch().count());
 }
 
-Character::Character(string name) : name(name) {
-  strength = generateRandomStrength(0, 1000);
-  cout << "Character successfully created" << endl;
+}  // namespace
+
+Character::Character(string name) : Character(name, clockSeed()) {}
+
+Character::Character(string name, uint64_t key, uint64_t stream)
+    : name(name), key(key), stream(stream), random(key, stream) {
+  strength = randomInt(0, 1000);
+  log() << "Character successfully created" << endl;
 
-  cout << "Strength: " << strength << endl;
+  log() << "Strength: " << strength << endl;
 }
 
+int Character::randomInt(int min, int max) {
+  // std::uniform_int_distribution differs between libraries, which would
+  // make a recorded fight play out differently elsewhere. Rejecting the
+  // top partial range keeps this unbiased.
+  uint32_t range = uint32_t(max - min) + 1;
+  uint32_t limit = uint32_t(-range) % range;
+  uint32_t draw;
+  do {
+    draw = random();
+  } while (draw < limit);
+  return min + int(draw % range);
+}
+
+double Character::randomUnit() { return (random() >> 8) * 0x1p-24; }
+
 void Character::displayLife() {
-  cout << this->name << " life: " << health << "%" << endl;
+  log() << this->name << " life: " << health << "%" << endl;
 }
 
 int Character::getStrength() { return this->strength; }
@@ -43,3 +57,15 @@ string Character::getName() { return this->name; }
 void Character::setStrength(int newStrength) { this->strength = newStrength; }
 
 void Character::setHealth(int newHealth) { this->health = newHealth; }
+
+void Character::loadState(const State& state) {
+  health = state.health;
+  strength = state.strength;
+  random = state.random;
+}
+
+std::ostream& Character::log() { return *logStream; }
+
+void Character::setLog(std::ostream* out) {
+  logStream = out != nullptr ? out : &silentStream;
+}
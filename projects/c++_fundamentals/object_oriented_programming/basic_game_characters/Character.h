@@ -1,16 +1,36 @@
 #ifndef CHARACTER_H
 #define CHARACTER_H
 
+#include <cstdint>
+#include <ostream>
 #include <string>
+
+#include "Philox.h"
 using std::string;
 
 class Character {
  protected:
   string name;
   int health = 100, strength;
+  // Every random decision a character makes comes from its own engine, so
+  // a character built from the same key and stream acts the same way again.
+  // A Philox stream costs nothing to set up and only 44 bytes to save, where
+  // a std::mt19937 takes microseconds and 5 KB.
+  uint64_t key, stream;
+  Philox4x32 random;
+
+  // Uniform in [min, max], computed the same way by every standard library
+  int randomInt(int min, int max);
+  // Uniform in [0, 1)
+  double randomUnit();
 
  public:
+  // Seeded from the clock, so every run is different
   Character(string name);
+  // Draws from the given Philox stream of key; a replay's seed is the key
+  // of stream 0
+  Character(string name, uint64_t key, uint64_t stream = 0);
+  virtual ~Character() = default;
 
   virtual void attack(Character& enemy) = 0;
   virtual void defend() = 0;
@@ -22,11 +42,31 @@ class Character {
 
   string getName();
 
+  uint64_t getKey() const { return key; }
+  uint64_t getStream() const { return stream; }
+
   void setStrength(int newStrength);
 
   void setHealth(int newHealth);
 
   void displayLife();
+
+  // Everything about a character that changes while it fights, for saving
+  // and restoring it. The Mage and Archer values derived from strength are
+  // set at construction and not part of it.
+  struct State {
+    int health;
+    int strength;
+    Philox4x32 random;
+  };
+  State saveState() const { return {health, strength, random}; }
+  void loadState(const State& state);
+
+  // Where characters report what they do; std::cout unless changed.
+  // nullptr silences them, e.g. while replaying thousands of fights. The
+  // setting belongs to the calling thread.
+  static std::ostream& log();
+  static void setLog(std::ostream* out);
 };
 
 #endif  // CHARACTER_H
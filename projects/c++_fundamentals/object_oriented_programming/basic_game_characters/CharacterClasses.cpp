@@ -0,0 +1,85 @@
+#include "CharacterClasses.h"
+
+#include "../../profiler/Profiler.h"
+
+using std::endl;
+
+void Warrior::attack(Character& enemy) {
+  PROFILE_ZONE("Warrior::attack");
+  int damage = (enemy.getStrength() - this->strength) * damagePercent / 100;
+
+  if (damage >= 0) {
+    int enemyHealth = enemy.getHealth();
+    enemy.setHealth(enemyHealth - (damage > enemyHealth ? enemyHealth : damage));
+
+    log() << "Successful attack" << endl;
+    log() << "Damage: " << damage << endl;
+
+  } else {
+    enemy.defend();
+  }
+}
+
+void Warrior::defend() {
+  log() << "Warrior " << name << " defended the attack" << endl;
+}
+
+void Warrior::move() { log() << "Moving like a Warrior" << endl; }
+
+Mage::Mage(string name) : Character(name) {
+  hitKilldamageChance = this->strength / 10;
+}
+
+Mage::Mage(string name, uint64_t key, uint64_t stream,
+           const Balance& balance)
+    : Character(name, key, stream) {
+  hitKilldamageChance = this->strength / balance.mageCriticalDivisor;
+}
+
+void Mage::attack(Character& enemy) {
+  PROFILE_ZONE("Mage::attack");
+  double minimalCritical = randomUnit();
+
+  if ((1 - minimalCritical) < (hitKilldamageChance / 100)) {
+    log() << "Mage " << name << " cursed a critical spell and kill "
+          << enemy.getName() << endl;
+    enemy.setHealth(0);
+  }
+}
+
+void Mage::defend() {
+  log() << "Mage " << name << " defended the attack" << endl;
+}
+
+void Mage::move() { log() << "Moving like a Mage" << endl; }
+
+Archer::Archer(string name) : Character(name) {
+  arrowQuiver = 10;
+  arrowDamage = this->strength / 100;
+}
+
+Archer::Archer(string name, uint64_t key, uint64_t stream,
+               const Balance& balance)
+    : Character(name, key, stream) {
+  arrowQuiver = balance.archerQuiver;
+  arrowDamage = this->strength / balance.archerDamageDivisor;
+}
+
+void Archer::attack(Character& enemy) {
+  PROFILE_ZONE("Archer::attack");
+  for (int i = 0; i <= arrowQuiver; i++) {
+    bool arrowReachedEnemy = randomInt(0, 1);
+
+    if (arrowReachedEnemy) {
+      log() << "An arrow hit " << enemy.getName() << endl;
+      log() << "Damage: " << arrowDamage << endl;
+      enemy.setHealth(enemy.getHealth() - arrowDamage);
+    }
+  }
+}
+
+void Archer::defend() {
+  log() << "Archer " << name << " defended the attack" << endl;
+}
+
+void Archer::move() { log() << "Moving like a Archer" << endl; }
@@ -0,0 +1,63 @@
+#ifndef CHARACTER_CLASSES_H
+#define CHARACTER_CLASSES_H
+
+#include "Character.h"
+
+// The numbers designers tune. The defaults are the original rules.
+struct Balance {
+  // Warrior damage, as a percentage of the strength difference
+  int warriorDamagePercent = 100;
+  // The Mage's chance in percent to kill outright is strength / this
+  int mageCriticalDivisor = 10;
+  // An Archer shoots one arrow more than this per attack
+  int archerQuiver = 10;
+  // Damage per arrow is strength / this
+  int archerDamageDivisor = 100;
+};
+
+class Warrior : public Character {
+ private:
+  int damagePercent = 100;
+
+ public:
+  Warrior(string name) : Character(name){};
+  Warrior(string name, uint64_t key, uint64_t stream = 0,
+          const Balance& balance = Balance())
+      : Character(name, key, stream),
+        damagePercent(balance.warriorDamagePercent){};
+
+  void attack(Character& enemy);
+  void defend();
+  void move();
+};
+
+class Mage : public Character {
+ private:
+  double hitKilldamageChance;
+
+ public:
+  Mage(string name);
+  Mage(string name, uint64_t key, uint64_t stream = 0,
+       const Balance& balance = Balance());
+
+  void attack(Character& enemy);
+  void defend();
+  void move();
+};
+
+class Archer : public Character {
+ private:
+  int arrowQuiver;
+  double arrowDamage;
+
+ public:
+  Archer(string name);
+  Archer(string name, uint64_t key, uint64_t stream = 0,
+         const Balance& balance = Balance());
+
+  void attack(Character& enemy);
+  void defend();
+  void move();
+};
+
+#endif  // CHARACTER_CLASSES_H
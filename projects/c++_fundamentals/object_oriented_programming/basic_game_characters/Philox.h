@@ -0,0 +1,63 @@
+#ifndef PHILOX_H
+#define PHILOX_H
+
+#include <array>
+#include <cstdint>
+
+// Philox4x32-10 (Salmon et al., "Parallel Random Numbers: As Easy as 1, 2,
+// 3"), a counter-based generator: the n-th block of four numbers is a keyed
+// hash of n, with no state carried from one block to the next.
+//
+// That makes streams free. Stream s of key k is every block whose counter
+// has s in its upper half, so job number s can draw from stream s on any
+// thread, in any order, and see the same numbers. Creating one costs
+// nothing, unlike seeding a std::mt19937, and the whole state is 44 bytes.
+class Philox4x32 {
+ public:
+  typedef uint32_t result_type;
+  typedef std::array<uint32_t, 4> Block;
+
+  Philox4x32() : Philox4x32(0, 0) {}
+  Philox4x32(uint64_t key, uint64_t stream)
+      : key{uint32_t(key), uint32_t(key >> 32)},
+        counter{0, 0, uint32_t(stream), uint32_t(stream >> 32)},
+        next(4) {}
+
+  static constexpr result_type min() { return 0; }
+  static constexpr result_type max() { return UINT32_MAX; }
+
+  result_type operator()() {
+    if (next == 4) {
+      block = generate(counter, key);
+      // The lower 64 bits count blocks within the stream
+      if (++counter[0] == 0) {
+        counter[1]++;
+      }
+      next = 0;
+    }
+    return block[next++];
+  }
+
+  // The block for one counter value
+  static Block generate(Block counter, std::array<uint32_t, 2> key) {
+    for (int round = 0; round < 10; round++) {
+      uint64_t product0 = uint64_t(0xD2511F53) * counter[0];
+      uint64_t product1 = uint64_t(0xCD9E8D57) * counter[2];
+      counter = {uint32_t(product1 >> 32) ^ counter[1] ^ key[0],
+                 uint32_t(product1),
+                 uint32_t(product0 >> 32) ^ counter[3] ^ key[1],
+                 uint32_t(product0)};
+      key[0] += 0x9E3779B9;
+      key[1] += 0xBB67AE85;
+    }
+    return counter;
+  }
+
+ private:
+  std::array<uint32_t, 2> key;
+  Block counter;
+  Block block;
+  int next;
+};
+
+#endif  // PHILOX_H
@@ -0,0 +1,375 @@
+#include "Replay.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+namespace {
+
+const char kMagic[4] = {'G', 'D', 'R', 'P'};
+// 2: characters draw from Philox4x32 instead of std::mt19937, so a version 1
+// recording would not play back the same
+const uint64_t kVersion = 2;
+
+const uint64_t kFnvOffset = 14695981039346656037ull;
+const uint64_t kFnvPrime = 1099511628211ull;
+
+uint64_t hashWord(uint64_t hash, uint32_t word) {
+  for (int shift = 0; shift < 32; shift += 8) {
+    hash ^= (word >> shift) & 0xff;
+    hash *= kFnvPrime;
+  }
+  return hash;
+}
+
+uint32_t checksum(const uint8_t* data, size_t size) {
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < size; i++) {
+    hash ^= data[i];
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+// LEB128: seven bits per byte, low bits first, high bit set on all but the
+// last byte
+void putVarint(std::vector<uint8_t>& out, uint64_t value) {
+  while (value >= 0x80) {
+    out.push_back(uint8_t(value | 0x80));
+    value >>= 7;
+  }
+  out.push_back(uint8_t(value));
+}
+
+void putFixed32(std::vector<uint8_t>& out, uint32_t value) {
+  for (int shift = 0; shift < 32; shift += 8) {
+    out.push_back(uint8_t(value >> shift));
+  }
+}
+
+class Reader {
+ public:
+  Reader(const std::vector<uint8_t>& bytes, size_t end)
+      : bytes(bytes), offset(0), end(end) {}
+
+  uint8_t byte() {
+    if (offset == end) {
+      throw std::runtime_error("Replay is truncated");
+    }
+    return bytes[offset++];
+  }
+
+  uint64_t varint() {
+    uint64_t value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+      uint8_t next = byte();
+      value |= uint64_t(next & 0x7f) << shift;
+      if (!(next & 0x80)) {
+        return value;
+      }
+    }
+    throw std::runtime_error("Replay has an overlong varint");
+  }
+
+  uint32_t varint32() {
+    uint64_t value = varint();
+    if (value > UINT32_MAX) {
+      throw std::runtime_error("Replay value out of range");
+    }
+    return uint32_t(value);
+  }
+
+  uint32_t fixed32() {
+    uint32_t value = 0;
+    for (int shift = 0; shift < 32; shift += 8) {
+      value |= uint32_t(byte()) << shift;
+    }
+    return value;
+  }
+
+  // A count of items that each take at least one byte; anything larger
+  // cannot be genuine and would only make the decoder allocate
+  size_t count() {
+    uint64_t value = varint();
+    if (value > end - offset) {
+      throw std::runtime_error("Replay count exceeds its size");
+    }
+    return size_t(value);
+  }
+
+  bool done() const { return offset == end; }
+
+ private:
+  const std::vector<uint8_t>& bytes;
+  size_t offset;
+  size_t end;
+};
+
+}  // namespace
+
+std::unique_ptr<Character> makeCharacter(CharacterClass type,
+                                         const string& name, uint64_t key,
+                                         uint64_t stream,
+                                         const Balance& balance) {
+  switch (type) {
+    case CharacterClass::Warrior:
+      return std::unique_ptr<Character>(
+          new Warrior(name, key, stream, balance));
+    case CharacterClass::Mage:
+      return std::unique_ptr<Character>(new Mage(name, key, stream, balance));
+    case CharacterClass::Archer:
+      return std::unique_ptr<Character>(
+          new Archer(name, key, stream, balance));
+  }
+  throw std::invalid_argument("Unknown character class");
+}
+
+std::unique_ptr<Character> makeCharacter(const Combatant& combatant,
+                                         const Balance& balance) {
+  return makeCharacter(combatant.type, combatant.name, combatant.seed, 0,
+                       balance);
+}
+
+Fight::Fight(const std::vector<Combatant>& roster)
+    : combatants(roster), currentTick(0) {
+  for (const Combatant& combatant : roster) {
+    characters.push_back(makeCharacter(combatant));
+  }
+}
+
+size_t Fight::aliveCount() const {
+  size_t count = 0;
+  for (size_t i = 0; i < characters.size(); i++) {
+    count += alive(i);
+  }
+  return count;
+}
+
+void Fight::attack(uint32_t attacker, uint32_t target) {
+  if (attacker >= characters.size() || target >= characters.size()) {
+    throw std::out_of_range("No such character in the fight");
+  }
+  characters[attacker]->attack(*characters[target]);
+}
+
+uint64_t Fight::stateHash() const {
+  uint64_t hash = hashWord(kFnvOffset, currentTick);
+  for (const auto& character : characters) {
+    hash = hashWord(hash, uint32_t(character->getHealth()));
+    hash = hashWord(hash, uint32_t(character->getStrength()));
+  }
+  return hash;
+}
+
+ReplayRecorder::ReplayRecorder(Fight& fight, bool hashTicks)
+    : fight(fight), hashTicks(hashTicks), attackedThisTick(false) {
+  recording.roster = fight.roster();
+  recording.ticks = fight.tick();
+}
+
+void ReplayRecorder::attack(uint32_t attacker, uint32_t target) {
+  fight.attack(attacker, target);
+  recording.commands.push_back({fight.tick(), attacker, target});
+  attackedThisTick = true;
+}
+
+void ReplayRecorder::endTick() {
+  if (hashTicks && attackedThisTick) {
+    recording.tickHashes.push_back(uint32_t(fight.stateHash()));
+  }
+  fight.endTick();
+  attackedThisTick = false;
+  recording.ticks = fight.tick();
+}
+
+std::vector<uint8_t> encodeReplay(const Replay& replay) {
+  std::vector<uint8_t> out(kMagic, kMagic + sizeof(kMagic));
+  putVarint(out, kVersion);
+  putVarint(out, replay.roster.size());
+  for (const Combatant& combatant : replay.roster) {
+    out.push_back(uint8_t(combatant.type));
+    putVarint(out, combatant.name.size());
+    out.insert(out.end(), combatant.name.begin(), combatant.name.end());
+    putFixed32(out, combatant.seed);
+  }
+
+  putVarint(out, replay.ticks);
+  putVarint(out, replay.commands.size());
+  uint32_t previousTick = 0;
+  for (const AttackCommand& command : replay.commands) {
+    if (command.tick < previousTick) {
+      throw std::invalid_argument("Replay commands are not in tick order");
+    }
+    putVarint(out, command.tick - previousTick);
+    putVarint(out, command.attacker);
+    putVarint(out, command.target);
+    previousTick = command.tick;
+  }
+
+  out.push_back(replay.tickHashes.empty() ? 0 : 1);
+  for (uint32_t hash : replay.tickHashes) {
+    putFixed32(out, hash);
+  }
+  putFixed32(out, checksum(out.data(), out.size()));
+  return out;
+}
+
+Replay decodeReplay(const std::vector<uint8_t>& bytes) {
+  if (bytes.size() < sizeof(kMagic) + sizeof(uint32_t) ||
+      !std::equal(kMagic, kMagic + sizeof(kMagic), bytes.begin())) {
+    throw std::runtime_error("Not a replay");
+  }
+  size_t end = bytes.size() - sizeof(uint32_t);
+  uint32_t stored = 0;
+  for (size_t i = 0; i < sizeof(uint32_t); i++) {
+    stored |= uint32_t(bytes[end + i]) << (8 * i);
+  }
+  if (stored != checksum(bytes.data(), end)) {
+    throw std::runtime_error("Replay checksum mismatch");
+  }
+
+  Reader in(bytes, end);
+  for (size_t i = 0; i < sizeof(kMagic); i++) {
+    in.byte();
+  }
+  if (in.varint() != kVersion) {
+    throw std::runtime_error("Unsupported replay version");
+  }
+
+  Replay replay;
+  replay.roster.resize(in.count());
+  for (Combatant& combatant : replay.roster) {
+    uint8_t type = in.byte();
+    if (type < uint8_t(CharacterClass::Warrior) ||
+        type > uint8_t(CharacterClass::Archer)) {
+      throw std::runtime_error("Replay has an unknown character class");
+    }
+    combatant.type = CharacterClass(type);
+    combatant.name.resize(in.count());
+    for (char& c : combatant.name) {
+      c = char(in.byte());
+    }
+    combatant.seed = in.fixed32();
+  }
+
+  replay.ticks = in.varint32();
+  replay.commands.resize(in.count());
+  uint32_t tick = 0;
+  size_t activeTicks = 0;
+  for (AttackCommand& command : replay.commands) {
+    uint32_t delta = in.varint32();
+    if (delta > replay.ticks - tick) {
+      throw std::runtime_error("Replay command past its last tick");
+    }
+    activeTicks += delta > 0 || activeTicks == 0;
+    tick += delta;
+    command.tick = tick;
+    command.attacker = in.varint32();
+    command.target = in.varint32();
+    if (command.attacker >= replay.roster.size() ||
+        command.target >= replay.roster.size()) {
+      throw std::runtime_error("Replay command names no character");
+    }
+  }
+  if (!replay.commands.empty() && tick >= replay.ticks) {
+    throw std::runtime_error("Replay command past its last tick");
+  }
+
+  if (in.byte() != 0) {
+    replay.tickHashes.resize(activeTicks);
+    for (uint32_t& hash : replay.tickHashes) {
+      hash = in.fixed32();
+    }
+  }
+  if (!in.done()) {
+    throw std::runtime_error("Replay has trailing bytes");
+  }
+  return replay;
+}
+
+void saveReplay(const Replay& replay, const std::string& path) {
+  std::vector<uint8_t> bytes = encodeReplay(replay);
+  std::ofstream out(path, std::ios::binary);
+  out.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+  if (!out) {
+    throw std::runtime_error("Cannot write " + path);
+  }
+}
+
+Replay loadReplay(const std::string& path) {
+  std::ifstream in(path, std::ios::binary);
+  if (!in) {
+    throw std::runtime_error("Cannot read " + path);
+  }
+  std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(in)),
+                             std::istreambuf_iterator<char>());
+  return decodeReplay(bytes);
+}
+
+ReplayResult resimulate(const Replay& replay, Fight& fight, bool verify) {
+  if (fight.tick() != 0) {
+    throw std::logic_error("resimulate needs a fight that has not started");
+  }
+  if (verify && replay.tickHashes.empty() && !replay.commands.empty()) {
+    throw std::invalid_argument("Replay was recorded without tick hashes");
+  }
+
+  ReplayResult result = {0, 0, false, 0};
+  size_t next = 0, hashIndex = 0;
+  while (fight.tick() < replay.ticks) {
+    bool attacked = false;
+    while (next < replay.commands.size() &&
+           replay.commands[next].tick == fight.tick()) {
+      fight.attack(replay.commands[next].attacker,
+                   replay.commands[next].target);
+      next++;
+      attacked = true;
+    }
+    if (verify && attacked &&
+        (hashIndex >= replay.tickHashes.size() ||
+         replay.tickHashes[hashIndex++] != uint32_t(fight.stateHash()))) {
+      result.desynced = true;
+      result.desyncTick = fight.tick();
+      break;
+    }
+    fight.endTick();
+    result.ticks++;
+  }
+  result.finalHash = fight.stateHash();
+  return result;
+}
+
+void playScriptedFight(Fight& fight, std::mt19937& script,
+                       ReplayRecorder* recorder, uint32_t maxTicks,
+                       uint32_t attackEvery) {
+  std::uniform_int_distribution<uint32_t> roll(0, attackEvery - 1);
+  std::vector<uint32_t> targets;
+  while (fight.tick() < maxTicks && fight.aliveCount() > 1) {
+    for (uint32_t attacker = 0; attacker < fight.size(); attacker++) {
+      if (!fight.alive(attacker) || roll(script) != 0) {
+        continue;
+      }
+      targets.clear();
+      for (uint32_t target = 0; target < fight.size(); target++) {
+        if (target != attacker && fight.alive(target)) {
+          targets.push_back(target);
+        }
+      }
+      if (targets.empty()) {
+        break;
+      }
+      uint32_t target = targets[script() % targets.size()];
+      if (recorder != nullptr) {
+        recorder->attack(attacker, target);
+      } else {
+        fight.attack(attacker, target);
+      }
+    }
+    if (recorder != nullptr) {
+      recorder->endTick();
+    } else {
+      fight.endTick();
+    }
+  }
+}
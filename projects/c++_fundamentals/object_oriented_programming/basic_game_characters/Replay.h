@@ -0,0 +1,142 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "CharacterClasses.h"
+
+// Deterministic recording and replay of fights.
+//
+// Every random decision a character makes comes from an engine seeded when
+// it is created. A fight is therefore fully described by its roster (class,
+// name and seed of each character) and the attacks issued in each tick. A
+// replay stores just that. Playing it back rebuilds the characters from
+// their seeds and re-issues the same attacks in the same ticks, which gives
+// the same fight without any timing or input.
+
+enum class CharacterClass : uint8_t { Warrior = 1, Mage = 2, Archer = 3 };
+
+struct Combatant {
+  CharacterClass type;
+  string name;
+  uint32_t seed;
+};
+
+struct AttackCommand {
+  uint32_t tick;
+  uint32_t attacker;  // Indices into the roster
+  uint32_t target;
+};
+
+// Throws std::invalid_argument for an unknown class
+std::unique_ptr<Character> makeCharacter(CharacterClass type,
+                                         const string& name, uint64_t key,
+                                         uint64_t stream,
+                                         const Balance& balance = Balance());
+// Draws from stream 0 of the combatant's seed
+std::unique_ptr<Character> makeCharacter(const Combatant& combatant,
+                                         const Balance& balance = Balance());
+
+// A fight advanced in lockstep: attacks are issued during a tick, which is
+// then closed with endTick. Characters report through Character::log().
+class Fight {
+ public:
+  explicit Fight(const std::vector<Combatant>& roster);
+
+  const std::vector<Combatant>& roster() const { return combatants; }
+  size_t size() const { return characters.size(); }
+  Character& operator[](size_t index) { return *characters[index]; }
+
+  uint32_t tick() const { return currentTick; }
+  // For restoring a saved state
+  void setTick(uint32_t tick) { currentTick = tick; }
+  bool alive(size_t index) const { return characters[index]->getHealth() > 0; }
+  size_t aliveCount() const;
+
+  // Throws std::out_of_range for an index outside the roster
+  void attack(uint32_t attacker, uint32_t target);
+  void endTick() { currentTick++; }
+
+  // FNV-1a over the tick and every character's health and strength. Only
+  // attacks change it, so quiet ticks need not be hashed.
+  uint64_t stateHash() const;
+
+ private:
+  std::vector<Combatant> combatants;
+  std::vector<std::unique_ptr<Character>> characters;
+  uint32_t currentTick;
+};
+
+struct Replay {
+  std::vector<Combatant> roster;
+  std::vector<AttackCommand> commands;  // In the order they were issued
+  uint32_t ticks = 0;                   // Including ticks without attacks
+  // Low 32 bits of the state hash after every tick that had attacks, for
+  // detecting desyncs; empty if the recording was made without them
+  std::vector<uint32_t> tickHashes;
+};
+
+// Issues attacks on a fight and records them
+class ReplayRecorder {
+ public:
+  explicit ReplayRecorder(Fight& fight, bool hashTicks = true);
+
+  void attack(uint32_t attacker, uint32_t target);
+  void endTick();
+
+  // Complete up to the last endTick
+  const Replay& replay() const { return recording; }
+
+ private:
+  Fight& fight;
+  Replay recording;
+  bool hashTicks;
+  bool attackedThisTick;
+};
+
+// Compact binary form:
+//   "GDRP" | varint version | varint roster size
+//   roster size * (uint8 class | varint name length | name | uint32 seed)
+//   varint ticks | varint command count
+//   count * (varint ticks since the previous command | varint attacker |
+//            varint target)
+//   uint8 has hashes | one uint32 per tick with attacks, if it has
+//   uint32 FNV-1a of everything before it
+// Fixed-width integers are little-endian. An attack in the same tick as the
+// one before it costs three bytes.
+std::vector<uint8_t> encodeReplay(const Replay& replay);
+// Throws std::runtime_error on a malformed or corrupted encoding
+Replay decodeReplay(const std::vector<uint8_t>& bytes);
+
+// Throw std::runtime_error if the file cannot be written or read
+void saveReplay(const Replay& replay, const std::string& path);
+Replay loadReplay(const std::string& path);
+
+struct ReplayResult {
+  uint32_t ticks;      // Ticks completed
+  uint64_t finalHash;  // State hash where playback stopped
+  bool desynced;
+  uint32_t desyncTick;  // First tick whose hash differed, if desynced
+};
+
+// Plays a replay back on a fight built from its roster, as fast as the
+// simulation runs. With verify, the state hash of every tick with attacks is
+// checked against the recording and playback stops at the first mismatch;
+// verify throws std::invalid_argument if the replay has no hashes.
+ReplayResult resimulate(const Replay& replay, Fight& fight,
+                        bool verify = false);
+
+// A stand-in for players: every tick each living character attacks a random
+// living opponent with probability 1/attackEvery. Stops once one character
+// is left or after maxTicks, and issues the attacks through recorder when it
+// is not null.
+void playScriptedFight(Fight& fight, std::mt19937& script,
+                       ReplayRecorder* recorder, uint32_t maxTicks,
+                       uint32_t attackEvery = 30);
+
+#endif  // REPLAY_H
@@ -0,0 +1,95 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include "Replay.h"
+
+using std::cout;
+using std::endl;
+
+// Records a scripted fight to a file, plays it back, or checks that it
+// still plays back the same way.
+//
+// Usage:
+//   combatReplay record <file> [seed]  Record Warrior vs Mage vs Archer
+//   combatReplay play <file>           Replay it with the combat log
+//   combatReplay verify <file>         Replay it silently, checking every
+//                                      tick against the recording
+
+// The rate the fight would run at in a game
+const double kTicksPerSecond = 60;
+const uint32_t kMaxTicks = 60 * 60 * 10;
+
+int record(const std::string& path, uint32_t seed) {
+  std::mt19937 seeds(seed);
+  std::vector<Combatant> roster = {
+      {CharacterClass::Warrior, "Thomas", uint32_t(seeds())},
+      {CharacterClass::Mage, "Alex", uint32_t(seeds())},
+      {CharacterClass::Archer, "Edison", uint32_t(seeds())}};
+
+  Character::setLog(nullptr);
+  Fight fight(roster);
+  ReplayRecorder recorder(fight);
+  playScriptedFight(fight, seeds, &recorder, kMaxTicks);
+  Character::setLog(&cout);
+
+  const Replay& replay = recorder.replay();
+  saveReplay(replay, path);
+  cout << "Recorded " << replay.ticks << " ticks ("
+       << replay.ticks / kTicksPerSecond << " s of play), "
+       << replay.commands.size() << " attacks, "
+       << encodeReplay(replay).size() << " bytes, to " << path << endl;
+  for (size_t i = 0; i < fight.size(); i++) {
+    fight[i].displayLife();
+  }
+  return 0;
+}
+
+int play(const std::string& path, bool verify) {
+  Replay replay = loadReplay(path);
+  if (verify) {
+    Character::setLog(nullptr);
+  }
+  auto begin = std::chrono::steady_clock::now();
+  Fight fight(replay.roster);
+  ReplayResult result = resimulate(replay, fight, verify);
+  double seconds = std::chrono::duration<double>(
+                       std::chrono::steady_clock::now() - begin)
+                       .count();
+  Character::setLog(&cout);
+
+  if (result.desynced) {
+    cout << "Desync at tick " << result.desyncTick << endl;
+    return 1;
+  }
+  for (size_t i = 0; i < fight.size(); i++) {
+    fight[i].displayLife();
+  }
+  cout << "Replayed " << result.ticks << " ticks in " << seconds * 1e3
+       << " ms, " << result.ticks / kTicksPerSecond / seconds
+       << "x real time" << (verify ? "; every tick matched" : "") << endl;
+  return 0;
+}
+
+int main(int argc, char* argv[]) {
+  std::string mode = argc > 1 ? argv[1] : "";
+  if (argc < 3 || (mode != "record" && mode != "play" && mode != "verify")) {
+    std::cerr << "Usage: " << argv[0] << " record|play|verify <file> [seed]"
+              << endl;
+    return 2;
+  }
+  try {
+    if (mode == "record") {
+      uint32_t seed = argc > 3 ? uint32_t(std::strtoul(argv[3], nullptr, 10))
+                               : std::random_device()();
+      return record(argv[2], seed);
+    }
+    return play(argv[2], mode == "verify");
+  } catch (const std::exception& error) {
+    std::cerr << error.what() << endl;
+    return 2;
+  }
+}
@@ -0,0 +1,147 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "Replay.h"
+
+using std::cout;
+using std::endl;
+
+// Measures what recording costs during a fight, how compact the recordings
+// are and how fast they play back.
+//
+// Usage: replayBenchmark [fights]
+
+const double kTicksPerSecond = 60;
+const uint32_t kMaxTicks = 60 * 60 * 10;
+
+std::vector<Combatant> makeRoster(uint32_t seed) {
+  std::mt19937 seeds(seed);
+  return {{CharacterClass::Warrior, "Thomas", uint32_t(seeds())},
+          {CharacterClass::Mage, "Alex", uint32_t(seeds())},
+          {CharacterClass::Archer, "Edison", uint32_t(seeds())}};
+}
+
+template <typename F>
+double timeSeconds(F body) {
+  auto begin = std::chrono::steady_clock::now();
+  body();
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                       begin)
+      .count();
+}
+
+void report(const char* label, double seconds, uint64_t ticks,
+            double baseline) {
+  cout << std::left << std::setw(28) << label << std::right << std::fixed
+       << std::setprecision(1) << std::setw(10) << seconds * 1e9 / ticks
+       << std::setw(14) << std::setprecision(0)
+       << ticks / kTicksPerSecond / seconds;
+  if (baseline > 0) {
+    cout << std::setw(10) << std::setprecision(1)
+         << (seconds / baseline - 1) * 100 << "%";
+  }
+  cout << endl;
+}
+
+int main(int argc, char* argv[]) {
+  int fights = argc > 1 ? std::max(1, std::atoi(argv[1])) : 2000;
+  Character::setLog(nullptr);
+
+  // Live play, first without recording to get the cost of the fight itself
+  uint64_t ticks = 0;
+  double plain = timeSeconds([&] {
+    for (int i = 0; i < fights; i++) {
+      Fight fight(makeRoster(i));
+      std::mt19937 script(i);
+      playScriptedFight(fight, script, nullptr, kMaxTicks);
+      ticks += fight.tick();
+    }
+  });
+
+  std::vector<Replay> replays;
+  double recorded = timeSeconds([&] {
+    for (int i = 0; i < fights; i++) {
+      Fight fight(makeRoster(i));
+      std::mt19937 script(i);
+      ReplayRecorder recorder(fight, false);
+      playScriptedFight(fight, script, &recorder, kMaxTicks);
+    }
+  });
+  double hashed = timeSeconds([&] {
+    for (int i = 0; i < fights; i++) {
+      Fight fight(makeRoster(i));
+      std::mt19937 script(i);
+      ReplayRecorder recorder(fight);
+      playScriptedFight(fight, script, &recorder, kMaxTicks);
+      replays.push_back(recorder.replay());
+    }
+  });
+
+  std::vector<std::vector<uint8_t>> files;
+  uint64_t bytes = 0, attacks = 0, hashBytes = 0;
+  double encoding = timeSeconds([&] {
+    for (const Replay& replay : replays) {
+      files.push_back(encodeReplay(replay));
+    }
+  });
+  for (size_t i = 0; i < replays.size(); i++) {
+    bytes += files[i].size();
+    attacks += replays[i].commands.size();
+    hashBytes += replays[i].tickHashes.size() * sizeof(uint32_t);
+  }
+  uint64_t decodedAttacks = 0;
+  double decoding = timeSeconds([&] {
+    for (const std::vector<uint8_t>& file : files) {
+      decodedAttacks += decodeReplay(file).commands.size();
+    }
+  });
+  if (decodedAttacks != attacks) {
+    std::cerr << "Decoding lost attacks" << endl;
+    return 1;
+  }
+
+  // Playback, from the decoded recordings
+  uint64_t desyncs = 0;
+  double replayed = timeSeconds([&] {
+    for (const Replay& replay : replays) {
+      Fight fight(replay.roster);
+      resimulate(replay, fight);
+    }
+  });
+  double verified = timeSeconds([&] {
+    for (const Replay& replay : replays) {
+      Fight fight(replay.roster);
+      desyncs += resimulate(replay, fight, true).desynced;
+    }
+  });
+
+  cout << fights << " fights, " << ticks << " ticks, " << attacks
+       << " attacks" << endl
+       << endl;
+  cout << std::left << std::setw(28) << "" << std::right << std::setw(10)
+       << "ns/tick" << std::setw(14) << "x real time" << std::setw(11)
+       << "overhead" << endl;
+  report("live", plain, ticks, 0);
+  report("live, recording", recorded, ticks, plain);
+  report("live, recording + hashes", hashed, ticks, plain);
+  report("replay", replayed, ticks, 0);
+  report("replay, verifying", verified, ticks, replayed);
+  cout << endl;
+
+  cout << std::setprecision(2) << "Recordings: " << bytes << " bytes, "
+       << double(bytes) / fights << " per fight, "
+       << double(bytes - hashBytes) / attacks << " per attack without the "
+       << hashBytes << " bytes of tick hashes" << endl;
+  cout << std::setprecision(0) << "Encode " << bytes / encoding / 1e6
+       << " MB/s, decode " << bytes / decoding / 1e6 << " MB/s" << endl;
+  if (desyncs > 0) {
+    cout << desyncs << " replays desynced" << endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,100 @@
+#include "Epoch.h"
+
+#include <stdexcept>
+
+namespace {
+
+std::atomic<bool> slotTaken[kMaxEpochThreads];
+
+// Claims an index the first time a thread asks for one and gives it back
+// when the thread exits
+struct ThreadSlot {
+  int index;
+
+  ThreadSlot() : index(-1) {
+    for (int i = 0; i < kMaxEpochThreads; i++) {
+      bool expected = false;
+      if (slotTaken[i].compare_exchange_strong(expected, true)) {
+        index = i;
+        return;
+      }
+    }
+    throw std::runtime_error("Too many threads using epoch reclamation");
+  }
+
+  ~ThreadSlot() { slotTaken[index].store(false); }
+};
+
+}  // namespace
+
+int currentThreadSlot() {
+  thread_local ThreadSlot slot;
+  return slot.index;
+}
+
+EpochManager::EpochManager() : globalEpoch(1), pendingCount(0) {}
+
+EpochManager::~EpochManager() {
+  for (Slot& slot : slots) {
+    for (const Retired& r : slot.retired) {
+      r.deleter(r.pointer);
+    }
+  }
+}
+
+void EpochManager::enter() {
+  Slot& slot = slots[currentThreadSlot()];
+  if (slot.depth++ > 0) {
+    return;
+  }
+  // Re-read after publishing so an advance that raced with us is not missed
+  uint64_t epoch;
+  do {
+    epoch = globalEpoch.load();
+    slot.epoch.store(epoch);
+  } while (globalEpoch.load() != epoch);
+}
+
+void EpochManager::exit() {
+  Slot& slot = slots[currentThreadSlot()];
+  if (--slot.depth == 0) {
+    slot.epoch.store(0);
+  }
+}
+
+void EpochManager::retire(void* pointer, Deleter deleter) {
+  Slot& slot = slots[currentThreadSlot()];
+  slot.retired.push_back({pointer, deleter, globalEpoch.load()});
+  pendingCount.fetch_add(1);
+  if (slot.retired.size() >= kCollectThreshold) {
+    collect();
+  }
+}
+
+bool EpochManager::tryAdvance() {
+  uint64_t epoch = globalEpoch.load();
+  for (const Slot& slot : slots) {
+    uint64_t pinned = slot.epoch.load();
+    if (pinned != 0 && pinned != epoch) {
+      return false;
+    }
+  }
+  return globalEpoch.compare_exchange_strong(epoch, epoch + 1);
+}
+
+void EpochManager::collect() {
+  tryAdvance();
+  uint64_t safeEpoch = globalEpoch.load();
+
+  std::vector<Retired>& retired = slots[currentThreadSlot()].retired;
+  size_t kept = 0;
+  for (size_t i = 0; i < retired.size(); i++) {
+    if (retired[i].epoch + 2 <= safeEpoch) {
+      retired[i].deleter(retired[i].pointer);
+      pendingCount.fetch_sub(1);
+    } else {
+      retired[kept++] = retired[i];
+    }
+  }
+  retired.resize(kept);
+}
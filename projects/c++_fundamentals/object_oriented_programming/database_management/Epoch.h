@@ -0,0 +1,90 @@
+#ifndef EPOCH_H
+#define EPOCH_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Upper bound on threads that can use epoch-protected structures at once
+const int kMaxEpochThreads = 128;
+
+// Small per-thread index in [0, kMaxEpochThreads), recycled on thread exit.
+// Throws std::runtime_error when every index is taken.
+int currentThreadSlot();
+
+// Epoch-based memory reclamation.
+//
+// Readers wrap every access to shared nodes in enter()/exit() (or a Guard).
+// Writers unlink a node and hand it to retire(); it is deleted only once the
+// global epoch has moved two steps past the retirement, which guarantees no
+// reader that could still hold the pointer is left.
+class EpochManager {
+ public:
+  typedef void (*Deleter)(void*);
+
+  class Guard {
+   private:
+    EpochManager& manager;
+
+   public:
+    explicit Guard(EpochManager& manager) : manager(manager) {
+      manager.enter();
+    }
+    ~Guard() { manager.exit(); }
+
+    Guard(const Guard&) = delete;
+    Guard& operator=(const Guard&) = delete;
+  };
+
+  EpochManager();
+  ~EpochManager();
+
+  EpochManager(const EpochManager&) = delete;
+  EpochManager& operator=(const EpochManager&) = delete;
+
+  // Pins the calling thread to the current epoch. Calls may nest.
+  void enter();
+  void exit();
+
+  void retire(void* pointer, Deleter deleter);
+
+  template <typename T>
+  void retire(T* pointer) {
+    retire(pointer, [](void* p) { delete static_cast<T*>(p); });
+  }
+
+  // Tries to advance the global epoch, then frees whatever the calling
+  // thread retired that is now unreachable.
+  void collect();
+
+  uint64_t currentEpoch() const { return globalEpoch.load(); }
+
+  // Objects retired by any thread and not freed yet
+  size_t pending() const { return pendingCount.load(); }
+
+ private:
+  struct Retired {
+    void* pointer;
+    Deleter deleter;
+    uint64_t epoch;
+  };
+
+  struct alignas(64) Slot {
+    // Epoch the owner is pinned to, 0 when it is outside a critical section
+    std::atomic<uint64_t> epoch{0};
+    // Only ever touched by the thread that owns the slot
+    int depth = 0;
+    std::vector<Retired> retired;
+  };
+
+  static const size_t kCollectThreshold = 64;
+
+  std::atomic<uint64_t> globalEpoch;
+  std::atomic<size_t> pendingCount;
+  Slot slots[kMaxEpochThreads];
+
+  bool tryAdvance();
+};
+
+#endif  // EPOCH_H
@@ -0,0 +1,101 @@
+#include "PasswordHash.h"
+
+#include <random>
+#include <sstream>
+
+namespace {
+
+std::vector<uint8_t> randomSalt(size_t length) {
+  static thread_local std::random_device rd;
+  std::vector<uint8_t> salt(length);
+  for (size_t i = 0; i < length; i += 4) {
+    uint32_t bits = rd();
+    for (size_t j = i; j < i + 4 && j < length; j++) {
+      salt[j] = static_cast<uint8_t>(bits >> (8 * (j - i)));
+    }
+  }
+  return salt;
+}
+
+void appendHex(std::stringstream& ss, const std::vector<uint8_t>& bytes) {
+  const char* digits = "0123456789abcdef";
+  for (uint8_t byte : bytes) {
+    ss << digits[byte >> 4] << digits[byte & 15];
+  }
+}
+
+}  // namespace
+
+PasswordHash PasswordHash::create(const std::string& password,
+                                  const ScryptParams& params) {
+  PasswordHash hash;
+  hash.params = params;
+  hash.salt = randomSalt(kSaltLength);
+  hash.digest = scrypt(password, hash.salt, params, kDigestLength);
+  return hash;
+}
+
+bool PasswordHash::verify(const std::string& password) const {
+  // One table per thread, kept between calls like a verifier worker's
+  static thread_local ScryptScratch scratch;
+  return verify(password, scratch);
+}
+
+bool PasswordHash::verify(const std::string& password,
+                          ScryptScratch& scratch) const {
+  if (digest.empty()) {
+    return false;
+  }
+  std::vector<uint8_t> candidate(digest.size());
+  scrypt(reinterpret_cast<const uint8_t*>(password.data()), password.size(),
+         salt.data(), salt.size(), params, candidate.data(), candidate.size(),
+         scratch);
+
+  // Compare every byte so the time taken does not reveal the mismatch index
+  uint8_t difference = 0;
+  for (size_t i = 0; i < digest.size(); i++) {
+    difference |= digest[i] ^ candidate[i];
+  }
+  return difference == 0;
+}
+
+std::string PasswordHash::toString() const {
+  int logN = 0;
+  while ((uint64_t(1) << logN) < params.n) {
+    logN++;
+  }
+  std::stringstream ss;
+  ss << "$scrypt$ln=" << logN << ",r=" << params.r << ",p=" << params.p
+     << "$";
+  appendHex(ss, salt);
+  ss << "$";
+  appendHex(ss, digest);
+  return ss.str();
+}
+
+ScryptParams calibrateScrypt(std::chrono::microseconds budget, uint32_t r) {
+  ScryptParams params;
+  params.r = r;
+  params.p = 1;
+
+  ScryptScratch scratch;
+  std::vector<uint8_t> salt(PasswordHash::kSaltLength, 0);
+  uint8_t out[PasswordHash::kDigestLength];
+  const uint8_t password[] = "calibration";
+
+  ScryptParams best = params;
+  best.n = 2;
+  // Cost is linear in n, so stop doubling once one derivation overshoots
+  for (uint64_t n = 2; n <= (uint64_t(1) << 24); n *= 2) {
+    params.n = n;
+    auto begin = std::chrono::steady_clock::now();
+    scrypt(password, sizeof(password) - 1, salt.data(), salt.size(), params,
+           out, sizeof(out), scratch);
+    auto elapsed = std::chrono::steady_clock::now() - begin;
+    if (elapsed > budget) {
+      break;
+    }
+    best = params;
+  }
+  return best;
+}
@@ -0,0 +1,44 @@
+#ifndef PASSWORD_HASH_H
+#define PASSWORD_HASH_H
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Scrypt.h"
+
+// Salted scrypt digest of a password together with the parameters that
+// produced it, so hashes made with older costs keep verifying
+class PasswordHash {
+ private:
+  ScryptParams params;
+  std::vector<uint8_t> salt;
+  std::vector<uint8_t> digest;
+
+ public:
+  static const size_t kSaltLength = 16;
+  static const size_t kDigestLength = 32;
+
+  PasswordHash() {}
+
+  // Hashes password under a fresh random salt
+  static PasswordHash create(const std::string& password,
+                             const ScryptParams& params = ScryptParams());
+
+  // Without a scratch, uses one kept per thread, which holds on to the
+  // largest table this thread has needed
+  bool verify(const std::string& password) const;
+  bool verify(const std::string& password, ScryptScratch& scratch) const;
+
+  const ScryptParams& getParams() const { return params; }
+
+  // $scrypt$ln=<log2 n>,r=<r>,p=<p>$<hex salt>$<hex digest>
+  std::string toString() const;
+};
+
+// Largest n (for the given r and p = 1) whose derivation still fits in
+// budget on this machine
+ScryptParams calibrateScrypt(std::chrono::microseconds budget, uint32_t r = 8);
+
+#endif  // PASSWORD_HASH_H
@@ -0,0 +1,90 @@
+#include "PasswordVerifier.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+PasswordVerifier::PasswordVerifier(unsigned threads,
+                                   std::chrono::microseconds budget)
+    : workers(threads),
+      budget(budget),
+      batch(nullptr),
+      cursor(0),
+      busyWorkers(0),
+      generation(0),
+      stopping(false) {
+  if (threads == 0) {
+    throw std::invalid_argument("PasswordVerifier needs at least one thread");
+  }
+  for (Worker& worker : workers) {
+    worker.thread = std::thread(&PasswordVerifier::workerLoop, this,
+                                std::ref(worker));
+  }
+}
+
+PasswordVerifier::~PasswordVerifier() {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stopping = true;
+  }
+  wake.notify_all();
+  for (Worker& worker : workers) {
+    worker.thread.join();
+  }
+}
+
+void PasswordVerifier::workerLoop(Worker& worker) {
+  unsigned long long seen = 0;
+  std::unique_lock<std::mutex> lock(mutex);
+  while (true) {
+    wake.wait(lock, [&]() { return stopping || generation != seen; });
+    if (stopping) {
+      return;
+    }
+    seen = generation;
+    lock.unlock();
+
+    const std::vector<LoginAttempt>& attempts = *batch;
+    for (size_t i = cursor.fetch_add(1); i < attempts.size();
+         i = cursor.fetch_add(1)) {
+      auto begin = std::chrono::steady_clock::now();
+      results[i] =
+          attempts[i].hash->verify(attempts[i].password, worker.scratch);
+      latencies[i] = std::chrono::duration_cast<std::chrono::microseconds>(
+                         std::chrono::steady_clock::now() - begin)
+                         .count();
+    }
+
+    lock.lock();
+    if (--busyWorkers == 0) {
+      finished.notify_one();
+    }
+  }
+}
+
+BatchResult PasswordVerifier::verifyBatch(
+    const std::vector<LoginAttempt>& attempts) {
+  std::lock_guard<std::mutex> turn(batchMutex);
+  std::unique_lock<std::mutex> lock(mutex);
+  batch = &attempts;
+  results.assign(attempts.size(), 0);
+  latencies.assign(attempts.size(), 0);
+  cursor.store(0);
+  busyWorkers = workers.size();
+  generation++;
+  wake.notify_all();
+  finished.wait(lock, [&]() { return busyWorkers == 0; });
+  batch = nullptr;
+
+  BatchResult result;
+  result.accepted.assign(results.begin(), results.end());
+  long long slowest = 0;
+  result.overBudget = 0;
+  for (long long latency : latencies) {
+    slowest = std::max(slowest, latency);
+    if (latency > budget.count()) {
+      result.overBudget++;
+    }
+  }
+  result.slowestCheck = std::chrono::microseconds(slowest);
+  return result;
+}
@@ -0,0 +1,67 @@
+#ifndef PASSWORD_VERIFIER_H
+#define PASSWORD_VERIFIER_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "PasswordHash.h"
+
+struct LoginAttempt {
+  const PasswordHash* hash;
+  std::string password;
+};
+
+struct BatchResult {
+  std::vector<bool> accepted;
+  std::chrono::microseconds slowestCheck;
+  // Checks that took longer than the verifier's latency budget
+  size_t overBudget;
+};
+
+// Fixed pool of worker threads that verifies batches of login attempts.
+// Workers pull attempts one at a time from a shared cursor, so a batch
+// spreads evenly over the pool, and each keeps its own scrypt scratch
+// memory between checks.
+class PasswordVerifier {
+ private:
+  struct Worker {
+    std::thread thread;
+    ScryptScratch scratch;
+  };
+
+  std::vector<Worker> workers;
+  std::chrono::microseconds budget;
+
+  // Held for the whole of verifyBatch so concurrent callers take turns
+  std::mutex batchMutex;
+  std::mutex mutex;
+  std::condition_variable wake, finished;
+  const std::vector<LoginAttempt>* batch;
+  std::vector<char> results;
+  std::vector<long long> latencies;
+  std::atomic<size_t> cursor;
+  size_t busyWorkers;
+  unsigned long long generation;
+  bool stopping;
+
+  void workerLoop(Worker& worker);
+
+ public:
+  PasswordVerifier(unsigned threads, std::chrono::microseconds budget);
+  ~PasswordVerifier();
+
+  PasswordVerifier(const PasswordVerifier&) = delete;
+  PasswordVerifier& operator=(const PasswordVerifier&) = delete;
+
+  // Blocks until every attempt in the batch has been checked
+  BatchResult verifyBatch(const std::vector<LoginAttempt>& attempts);
+
+  size_t size() const { return workers.size(); }
+};
+
+#endif  // PASSWORD_VERIFIER_H
@@ -0,0 +1,99 @@
+#ifndef RECORD_H
+#define RECORD_H
+
+#include <ctime>
+#include <iostream>
+#include <string>
+
+#include "PasswordHash.h"
+
+template <typename T>
+class VersionedStore;
+
+class Record {
+ protected:
+  int id;
+  std::time_t createdAt;
+  std::time_t updatedAt;
+
+ public:
+  Record(int id) : id(id), createdAt(std::time(0)), updatedAt(std::time(0)) {}
+  virtual ~Record() {}
+
+  virtual void save() {
+    std::cout << "Saving record with id: " << id << "\n";
+    updatedAt = std::time(0);
+  }
+
+  virtual void update() {
+    std::cout << "Updating record with id: " << id << "\n";
+    updatedAt = std::time(0);
+  }
+
+  virtual void deleteRecord() {
+    std::cout << "Deleting record with id: " << id << "\n";
+  }
+
+  int getId() const { return id; }
+
+  std::time_t getCreatedAt() const { return createdAt; }
+
+  std::time_t getUpdatedAt() const { return updatedAt; }
+
+  // The store stamps updatedAt on every version it creates
+  template <typename T>
+  friend class VersionedStore;
+};
+
+class UserRecord : public Record {
+ private:
+  std::string name;
+  std::string email;
+  PasswordHash password;
+
+ public:
+  // Only a salted hash of password is kept
+  UserRecord(int id, std::string name, std::string email, std::string password,
+             const ScryptParams& params = ScryptParams())
+      : Record(id),
+        name(name),
+        email(email),
+        password(PasswordHash::create(password, params)) {}
+
+  const std::string& getName() const { return name; }
+  const std::string& getEmail() const { return email; }
+  const PasswordHash& getPasswordHash() const { return password; }
+
+  bool checkPassword(const std::string& candidate) const {
+    return password.verify(candidate);
+  }
+
+  void setEmail(const std::string& newEmail) { email = newEmail; }
+  void setPassword(const std::string& newPassword,
+                   const ScryptParams& params = ScryptParams()) {
+    password = PasswordHash::create(newPassword, params);
+  }
+};
+
+class ProductRecord : public Record {
+ private:
+  std::string productName;
+  double price;
+  int quantity;
+
+ public:
+  ProductRecord(int id, std::string productName, double price, int quantity)
+      : Record(id),
+        productName(productName),
+        price(price),
+        quantity(quantity) {}
+
+  const std::string& getProductName() const { return productName; }
+  double getPrice() const { return price; }
+  int getQuantity() const { return quantity; }
+
+  void setPrice(double newPrice) { price = newPrice; }
+  void setQuantity(int newQuantity) { quantity = newQuantity; }
+};
+
+#endif  // RECORD_H
@@ -0,0 +1,334 @@
+#include "Scrypt.h"
+
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+
+const uint32_t kSha256K[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1,
+    0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786,
+    0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147,
+    0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+    0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a,
+    0x5b9cca4f, 0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+inline uint32_t rotr(uint32_t x, int n) { return (x >> n) | (x << (32 - n)); }
+inline uint32_t rotl(uint32_t x, int n) { return (x << n) | (x >> (32 - n)); }
+
+inline uint32_t loadBigEndian(const uint8_t* p) {
+  return (uint32_t(p[0]) << 24) | (uint32_t(p[1]) << 16) |
+         (uint32_t(p[2]) << 8) | uint32_t(p[3]);
+}
+
+inline void storeBigEndian(uint8_t* p, uint32_t v) {
+  p[0] = v >> 24;
+  p[1] = v >> 16;
+  p[2] = v >> 8;
+  p[3] = v;
+}
+
+inline uint32_t loadLittleEndian(const uint8_t* p) {
+  return uint32_t(p[0]) | (uint32_t(p[1]) << 8) | (uint32_t(p[2]) << 16) |
+         (uint32_t(p[3]) << 24);
+}
+
+inline void storeLittleEndian(uint8_t* p, uint32_t v) {
+  p[0] = v;
+  p[1] = v >> 8;
+  p[2] = v >> 16;
+  p[3] = v >> 24;
+}
+
+class Sha256 {
+ private:
+  uint32_t state[8];
+  uint8_t buffer[64];
+  size_t buffered;
+  uint64_t length;
+
+  void compress(const uint8_t* chunk) {
+    uint32_t w[64];
+    for (int i = 0; i < 16; i++) {
+      w[i] = loadBigEndian(chunk + 4 * i);
+    }
+    for (int i = 16; i < 64; i++) {
+      uint32_t s0 = rotr(w[i - 15], 7) ^ rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+      uint32_t s1 = rotr(w[i - 2], 17) ^ rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+      w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+    uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+    for (int i = 0; i < 64; i++) {
+      uint32_t s1 = rotr(e, 6) ^ rotr(e, 11) ^ rotr(e, 25);
+      uint32_t ch = (e & f) ^ (~e & g);
+      uint32_t t1 = h + s1 + ch + kSha256K[i] + w[i];
+      uint32_t s0 = rotr(a, 2) ^ rotr(a, 13) ^ rotr(a, 22);
+      uint32_t maj = (a & b) ^ (a & c) ^ (b & c);
+      uint32_t t2 = s0 + maj;
+      h = g;
+      g = f;
+      f = e;
+      e = d + t1;
+      d = c;
+      c = b;
+      b = a;
+      a = t1 + t2;
+    }
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+    state[5] += f;
+    state[6] += g;
+    state[7] += h;
+  }
+
+ public:
+  Sha256() : buffered(0), length(0) {
+    const uint32_t initial[8] = {0x6a09e667, 0xbb67ae85, 0x3c6ef372,
+                                 0xa54ff53a, 0x510e527f, 0x9b05688c,
+                                 0x1f83d9ab, 0x5be0cd19};
+    std::memcpy(state, initial, sizeof(state));
+  }
+
+  void update(const uint8_t* data, size_t size) {
+    length += size;
+    if (buffered > 0) {
+      size_t take = 64 - buffered < size ? 64 - buffered : size;
+      std::memcpy(buffer + buffered, data, take);
+      buffered += take;
+      data += take;
+      size -= take;
+      if (buffered < 64) {
+        return;
+      }
+      compress(buffer);
+      buffered = 0;
+    }
+    for (; size >= 64; size -= 64, data += 64) {
+      compress(data);
+    }
+    std::memcpy(buffer, data, size);
+    buffered = size;
+  }
+
+  void finish(uint8_t digest[32]) {
+    uint64_t bits = length * 8;
+    uint8_t padding[72] = {0x80};
+    size_t padLength = buffered < 56 ? 56 - buffered : 120 - buffered;
+    for (int i = 0; i < 8; i++) {
+      padding[padLength + i] = static_cast<uint8_t>(bits >> (56 - 8 * i));
+    }
+    update(padding, padLength + 8);
+    for (int i = 0; i < 8; i++) {
+      storeBigEndian(digest + 4 * i, state[i]);
+    }
+  }
+};
+
+// HMAC-SHA256 with the keyed inner and outer states computed once, since
+// PBKDF2 reuses the same key for every block
+class HmacSha256 {
+ private:
+  Sha256 inner, outer;
+
+ public:
+  HmacSha256(const uint8_t* key, size_t keyLength) {
+    uint8_t block[64] = {0};
+    if (keyLength > 64) {
+      Sha256 hashedKey;
+      hashedKey.update(key, keyLength);
+      hashedKey.finish(block);
+    } else {
+      std::memcpy(block, key, keyLength);
+    }
+
+    uint8_t pad[64];
+    for (int i = 0; i < 64; i++) {
+      pad[i] = block[i] ^ 0x36;
+    }
+    inner.update(pad, 64);
+    for (int i = 0; i < 64; i++) {
+      pad[i] = block[i] ^ 0x5c;
+    }
+    outer.update(pad, 64);
+  }
+
+  // Copies of the keyed states, so one key can authenticate many messages
+  Sha256 begin() const { return inner; }
+
+  void end(Sha256& message, uint8_t mac[32]) const {
+    uint8_t innerDigest[32];
+    message.finish(innerDigest);
+    Sha256 result = outer;
+    result.update(innerDigest, 32);
+    result.finish(mac);
+  }
+};
+
+void salsa20_8(uint32_t b[16]) {
+  uint32_t x[16];
+  std::memcpy(x, b, sizeof(x));
+  for (int i = 0; i < 8; i += 2) {
+    x[4] ^= rotl(x[0] + x[12], 7);
+    x[8] ^= rotl(x[4] + x[0], 9);
+    x[12] ^= rotl(x[8] + x[4], 13);
+    x[0] ^= rotl(x[12] + x[8], 18);
+    x[9] ^= rotl(x[5] + x[1], 7);
+    x[13] ^= rotl(x[9] + x[5], 9);
+    x[1] ^= rotl(x[13] + x[9], 13);
+    x[5] ^= rotl(x[1] + x[13], 18);
+    x[14] ^= rotl(x[10] + x[6], 7);
+    x[2] ^= rotl(x[14] + x[10], 9);
+    x[6] ^= rotl(x[2] + x[14], 13);
+    x[10] ^= rotl(x[6] + x[2], 18);
+    x[3] ^= rotl(x[15] + x[11], 7);
+    x[7] ^= rotl(x[3] + x[15], 9);
+    x[11] ^= rotl(x[7] + x[3], 13);
+    x[15] ^= rotl(x[11] + x[7], 18);
+
+    x[1] ^= rotl(x[0] + x[3], 7);
+    x[2] ^= rotl(x[1] + x[0], 9);
+    x[3] ^= rotl(x[2] + x[1], 13);
+    x[0] ^= rotl(x[3] + x[2], 18);
+    x[6] ^= rotl(x[5] + x[4], 7);
+    x[7] ^= rotl(x[6] + x[5], 9);
+    x[4] ^= rotl(x[7] + x[6], 13);
+    x[5] ^= rotl(x[4] + x[7], 18);
+    x[11] ^= rotl(x[10] + x[9], 7);
+    x[8] ^= rotl(x[11] + x[10], 9);
+    x[9] ^= rotl(x[8] + x[11], 13);
+    x[10] ^= rotl(x[9] + x[8], 18);
+    x[12] ^= rotl(x[15] + x[14], 7);
+    x[13] ^= rotl(x[12] + x[15], 9);
+    x[14] ^= rotl(x[13] + x[12], 13);
+    x[15] ^= rotl(x[14] + x[13], 18);
+  }
+  for (int i = 0; i < 16; i++) {
+    b[i] += x[i];
+  }
+}
+
+// scryptBlockMix: in and out are 2 * r blocks of 16 words each
+void blockMix(const uint32_t* in, uint32_t* out, uint32_t r) {
+  uint32_t x[16];
+  std::memcpy(x, in + (2 * r - 1) * 16, sizeof(x));
+  for (uint32_t i = 0; i < 2 * r; i++) {
+    for (int j = 0; j < 16; j++) {
+      x[j] ^= in[i * 16 + j];
+    }
+    salsa20_8(x);
+    // Even blocks go to the first half of the output, odd ones to the second
+    uint32_t* target = out + ((i & 1) * r + i / 2) * 16;
+    std::memcpy(target, x, sizeof(x));
+  }
+}
+
+void roMix(uint8_t* block, uint32_t r, uint64_t n, uint32_t* table,
+           uint32_t* x, uint32_t* y) {
+  const size_t words = 32 * r;
+  for (size_t i = 0; i < words; i++) {
+    x[i] = loadLittleEndian(block + 4 * i);
+  }
+
+  for (uint64_t i = 0; i < n; i++) {
+    std::memcpy(table + i * words, x, words * sizeof(uint32_t));
+    blockMix(x, y, r);
+    std::swap(x, y);
+  }
+  for (uint64_t i = 0; i < n; i++) {
+    // Integerify: first word of the last 64-byte block
+    uint64_t j = x[(2 * r - 1) * 16] & (n - 1);
+    const uint32_t* v = table + j * words;
+    for (size_t k = 0; k < words; k++) {
+      x[k] ^= v[k];
+    }
+    blockMix(x, y, r);
+    std::swap(x, y);
+  }
+
+  for (size_t i = 0; i < words; i++) {
+    storeLittleEndian(block + 4 * i, x[i]);
+  }
+}
+
+}  // namespace
+
+void pbkdf2Sha256(const uint8_t* password, size_t passwordLength,
+                  const uint8_t* salt, size_t saltLength, uint32_t iterations,
+                  uint8_t* out, size_t outLength) {
+  HmacSha256 hmac(password, passwordLength);
+
+  for (uint32_t blockIndex = 1; outLength > 0; blockIndex++) {
+    uint8_t counter[4];
+    storeBigEndian(counter, blockIndex);
+
+    Sha256 message = hmac.begin();
+    message.update(salt, saltLength);
+    message.update(counter, 4);
+    uint8_t u[32], t[32];
+    hmac.end(message, u);
+    std::memcpy(t, u, 32);
+
+    for (uint32_t i = 1; i < iterations; i++) {
+      Sha256 next = hmac.begin();
+      next.update(u, 32);
+      hmac.end(next, u);
+      for (int k = 0; k < 32; k++) {
+        t[k] ^= u[k];
+      }
+    }
+
+    size_t take = outLength < 32 ? outLength : 32;
+    std::memcpy(out, t, take);
+    out += take;
+    outLength -= take;
+  }
+}
+
+void scrypt(const uint8_t* password, size_t passwordLength, const uint8_t* salt,
+            size_t saltLength, const ScryptParams& params, uint8_t* out,
+            size_t outLength, ScryptScratch& scratch) {
+  if (params.n < 2 || (params.n & (params.n - 1)) != 0) {
+    throw std::invalid_argument("scrypt n must be a power of two above 1");
+  }
+  if (params.r == 0 || params.p == 0) {
+    throw std::invalid_argument("scrypt r and p must be positive");
+  }
+
+  const size_t blockBytes = 128 * static_cast<size_t>(params.r);
+  std::vector<uint8_t> blocks(blockBytes * params.p);
+  pbkdf2Sha256(password, passwordLength, salt, saltLength, 1, blocks.data(),
+               blocks.size());
+
+  const size_t words = 32 * static_cast<size_t>(params.r);
+  scratch.table.resize(words * params.n);
+  scratch.block.resize(2 * words);
+  for (uint32_t i = 0; i < params.p; i++) {
+    roMix(blocks.data() + i * blockBytes, params.r, params.n,
+          scratch.table.data(), scratch.block.data(),
+          scratch.block.data() + words);
+  }
+
+  pbkdf2Sha256(password, passwordLength, blocks.data(), blocks.size(), 1, out,
+               outLength);
+}
+
+std::vector<uint8_t> scrypt(const std::string& password,
+                            const std::vector<uint8_t>& salt,
+                            const ScryptParams& params, size_t outLength) {
+  ScryptScratch scratch;
+  std::vector<uint8_t> out(outLength);
+  scrypt(reinterpret_cast<const uint8_t*>(password.data()), password.size(),
+         salt.data(), salt.size(), params, out.data(), outLength, scratch);
+  return out;
+}
@@ -0,0 +1,44 @@
+#ifndef SCRYPT_H
+#define SCRYPT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Cost parameters of the scrypt key derivation function (RFC 7914).
+// Memory per derivation is 128 * r * n bytes, time grows with n * r * p.
+struct ScryptParams {
+  uint64_t n = 1 << 14;
+  uint32_t r = 8;
+  uint32_t p = 1;
+
+  size_t memoryBytes() const { return 128 * static_cast<size_t>(r) * n; }
+};
+
+// Working memory for scrypt. Reusing one per thread avoids allocating and
+// zeroing the whole n-sized table on every derivation.
+class ScryptScratch {
+ private:
+  std::vector<uint32_t> table;
+  std::vector<uint32_t> block;
+
+  friend void scrypt(const uint8_t*, size_t, const uint8_t*, size_t,
+                     const ScryptParams&, uint8_t*, size_t, ScryptScratch&);
+};
+
+void pbkdf2Sha256(const uint8_t* password, size_t passwordLength,
+                  const uint8_t* salt, size_t saltLength, uint32_t iterations,
+                  uint8_t* out, size_t outLength);
+
+// Throws std::invalid_argument when n is not a power of two greater than 1
+// or r and p are zero
+void scrypt(const uint8_t* password, size_t passwordLength, const uint8_t* salt,
+            size_t saltLength, const ScryptParams& params, uint8_t* out,
+            size_t outLength, ScryptScratch& scratch);
+
+std::vector<uint8_t> scrypt(const std::string& password,
+                            const std::vector<uint8_t>& salt,
+                            const ScryptParams& params, size_t outLength);
+
+#endif  // SCRYPT_H
@@ -0,0 +1,112 @@
+#ifndef VERSIONED_STORE_H
+#define VERSIONED_STORE_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Epoch.h"
+
+// Multi-version store for Record types, indexed by record id.
+//
+// Every write creates a new version of the record, stamps its updatedAt and
+// links it in front of the previous ones. Readers open a Snapshot, which
+// sees each record as it was at the snapshot's commit timestamp and never
+// takes a lock. Writers are serialized by a single commit mutex. A
+// background thread unlinks versions no open snapshot can reach and
+// reclaims them through an EpochManager.
+template <typename T>
+class VersionedStore {
+ private:
+  struct Version {
+    T value;
+    uint64_t commitTs;
+    bool deleted;
+    std::atomic<Version*> older;
+
+    Version(const T& value, uint64_t commitTs, bool deleted, Version* older)
+        : value(value), commitTs(commitTs), deleted(deleted), older(older) {}
+  };
+
+  struct alignas(64) ReaderSlot {
+    // Oldest commit timestamp the owning thread may read, 0 when idle
+    std::atomic<uint64_t> timestamp{0};
+    int depth = 0;
+  };
+
+  std::vector<std::atomic<Version*>> heads;
+  std::atomic<uint64_t> clock;
+  ReaderSlot readers[kMaxEpochThreads];
+
+  std::mutex commitMutex;
+  std::vector<int> touchedIds;
+  // Held for a whole collection pass, so passes never overlap
+  std::mutex collectionMutex;
+
+  EpochManager epochs;
+  std::thread collector;
+  std::mutex collectorMutex;
+  std::condition_variable collectorWake;
+  bool stopping;
+  std::chrono::milliseconds collectInterval;
+
+  std::atomic<size_t> liveVersions;
+
+  void checkId(int id) const;
+  uint64_t commit(int id, Version* version);
+  uint64_t oldestVisibleTimestamp() const;
+  void collectorLoop();
+
+ public:
+  class Snapshot {
+   private:
+    VersionedStore& store;
+    uint64_t ts;
+
+   public:
+    explicit Snapshot(VersionedStore& store);
+    ~Snapshot();
+
+    Snapshot(const Snapshot&) = delete;
+    Snapshot& operator=(const Snapshot&) = delete;
+
+    // Record as of this snapshot, nullptr if it did not exist or was deleted.
+    // The pointer stays valid until the snapshot is destroyed.
+    const T* get(int id) const;
+
+    uint64_t timestamp() const { return ts; }
+  };
+
+  explicit VersionedStore(
+      int capacity, std::chrono::milliseconds collectInterval =
+                        std::chrono::milliseconds(10));
+  ~VersionedStore();
+
+  VersionedStore(const VersionedStore&) = delete;
+  VersionedStore& operator=(const VersionedStore&) = delete;
+
+  Snapshot snapshot() { return Snapshot(*this); }
+
+  // Each write returns the commit timestamp of the version it created
+  uint64_t insert(const T& record);
+
+  template <typename Mutator>
+  uint64_t update(int id, Mutator mutate);
+
+  uint64_t remove(int id);
+
+  // Runs one collection pass on the calling thread, after waiting for any
+  // pass the background thread has in progress
+  void collectGarbage();
+
+  int capacity() const { return static_cast<int>(heads.size()); }
+  uint64_t lastCommit() const { return clock.load(); }
+  size_t versionCount() const { return liveVersions.load(); }
+};
+
+#include "VersionedStore.tpp"
+#endif  // VERSIONED_STORE_H
@@ -0,0 +1,217 @@
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+#include "VersionedStore.h"
+
+template <typename T>
+VersionedStore<T>::VersionedStore(int capacity,
+                                  std::chrono::milliseconds collectInterval)
+    : heads(capacity),
+      clock(1),
+      stopping(false),
+      collectInterval(collectInterval),
+      liveVersions(0) {
+  for (std::atomic<Version*>& head : heads) {
+    head.store(nullptr);
+  }
+  collector = std::thread(&VersionedStore::collectorLoop, this);
+}
+
+template <typename T>
+VersionedStore<T>::~VersionedStore() {
+  {
+    std::lock_guard<std::mutex> lock(collectorMutex);
+    stopping = true;
+  }
+  collectorWake.notify_one();
+  collector.join();
+
+  for (std::atomic<Version*>& head : heads) {
+    Version* version = head.load();
+    while (version != nullptr) {
+      Version* older = version->older.load();
+      delete version;
+      version = older;
+    }
+  }
+}
+
+template <typename T>
+void VersionedStore<T>::checkId(int id) const {
+  if (id < 0 || id >= static_cast<int>(heads.size())) {
+    throw std::out_of_range("Record id out of range");
+  }
+}
+
+template <typename T>
+uint64_t VersionedStore<T>::commit(int id, Version* version) {
+  // Caller holds commitMutex. The version becomes reachable before the clock
+  // moves, so a snapshot taken at the new timestamp is guaranteed to find it.
+  uint64_t ts = clock.load() + 1;
+  version->commitTs = ts;
+  version->value.updatedAt = std::time(0);
+  heads[id].store(version, std::memory_order_release);
+  clock.store(ts, std::memory_order_release);
+  touchedIds.push_back(id);
+  liveVersions.fetch_add(1);
+  return ts;
+}
+
+template <typename T>
+uint64_t VersionedStore<T>::insert(const T& record) {
+  int id = record.getId();
+  checkId(id);
+  std::lock_guard<std::mutex> lock(commitMutex);
+  Version* head = heads[id].load();
+  if (head != nullptr && !head->deleted) {
+    throw std::invalid_argument("Record already exists");
+  }
+  return commit(id, new Version(record, 0, false, head));
+}
+
+template <typename T>
+template <typename Mutator>
+uint64_t VersionedStore<T>::update(int id, Mutator mutate) {
+  checkId(id);
+  std::lock_guard<std::mutex> lock(commitMutex);
+  Version* head = heads[id].load();
+  if (head == nullptr || head->deleted) {
+    throw std::out_of_range("Record not found");
+  }
+  Version* version = new Version(head->value, 0, false, head);
+  mutate(version->value);
+  return commit(id, version);
+}
+
+template <typename T>
+uint64_t VersionedStore<T>::remove(int id) {
+  checkId(id);
+  std::lock_guard<std::mutex> lock(commitMutex);
+  Version* head = heads[id].load();
+  if (head == nullptr || head->deleted) {
+    throw std::out_of_range("Record not found");
+  }
+  return commit(id, new Version(head->value, 0, true, head));
+}
+
+template <typename T>
+uint64_t VersionedStore<T>::oldestVisibleTimestamp() const {
+  // Reading the clock first means a snapshot that registers after this scan
+  // can only be newer than the value returned
+  uint64_t oldest = clock.load();
+  for (const ReaderSlot& reader : readers) {
+    uint64_t ts = reader.timestamp.load();
+    if (ts != 0 && ts < oldest) {
+      oldest = ts;
+    }
+  }
+  return oldest;
+}
+
+template <typename T>
+void VersionedStore<T>::collectGarbage() {
+  // A pass takes every touched id for itself; one that ran alongside would
+  // find none and return before the other had reclaimed anything
+  std::lock_guard<std::mutex> pass(collectionMutex);
+  std::vector<int> ids;
+  {
+    std::lock_guard<std::mutex> lock(commitMutex);
+    ids.swap(touchedIds);
+  }
+  std::sort(ids.begin(), ids.end());
+  ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+
+  uint64_t oldest = oldestVisibleTimestamp();
+  std::vector<int> stillShared;
+  std::vector<std::pair<int, Version*>> tombstones;
+
+  for (int id : ids) {
+    // The newest version at or below `oldest` is what the oldest snapshot
+    // sees; everything behind it is unreachable from now on
+    Version* keep = heads[id].load(std::memory_order_acquire);
+    while (keep != nullptr && keep->commitTs > oldest) {
+      keep = keep->older.load(std::memory_order_acquire);
+    }
+    if (keep == nullptr) {
+      stillShared.push_back(id);
+      continue;
+    }
+    if (keep != heads[id].load()) {
+      stillShared.push_back(id);
+    } else if (keep->deleted) {
+      tombstones.emplace_back(id, keep);
+    }
+
+    Version* tail = keep->older.exchange(nullptr);
+    while (tail != nullptr) {
+      Version* next = tail->older.load();
+      epochs.retire(tail);
+      liveVersions.fetch_sub(1);
+      tail = next;
+    }
+  }
+
+  {
+    // A deletion every snapshot already sees reads the same as no record at
+    // all, so the tombstone goes too. Under the commit mutex, because an
+    // insert links its version in front of the current head; if one got in
+    // first, the tombstone is an old version and a later pass takes it.
+    std::lock_guard<std::mutex> lock(commitMutex);
+    for (const std::pair<int, Version*>& tombstone : tombstones) {
+      if (heads[tombstone.first].load() == tombstone.second) {
+        heads[tombstone.first].store(nullptr, std::memory_order_release);
+        epochs.retire(tombstone.second);
+        liveVersions.fetch_sub(1);
+      }
+    }
+    touchedIds.insert(touchedIds.end(), stillShared.begin(),
+                      stillShared.end());
+  }
+  epochs.collect();
+}
+
+template <typename T>
+void VersionedStore<T>::collectorLoop() {
+  std::unique_lock<std::mutex> lock(collectorMutex);
+  while (!stopping) {
+    collectorWake.wait_for(lock, collectInterval);
+    lock.unlock();
+    collectGarbage();
+    lock.lock();
+  }
+}
+
+template <typename T>
+VersionedStore<T>::Snapshot::Snapshot(VersionedStore& store) : store(store) {
+  store.epochs.enter();
+  ReaderSlot& reader = store.readers[currentThreadSlot()];
+  if (reader.depth++ == 0) {
+    // Publish a lower bound first; the collector keeps everything visible
+    // at or after whatever it reads here
+    reader.timestamp.store(store.clock.load());
+  }
+  ts = store.clock.load(std::memory_order_acquire);
+}
+
+template <typename T>
+VersionedStore<T>::Snapshot::~Snapshot() {
+  ReaderSlot& reader = store.readers[currentThreadSlot()];
+  if (--reader.depth == 0) {
+    reader.timestamp.store(0);
+  }
+  store.epochs.exit();
+}
+
+template <typename T>
+const T* VersionedStore<T>::Snapshot::get(int id) const {
+  store.checkId(id);
+  Version* version = store.heads[id].load(std::memory_order_acquire);
+  while (version != nullptr && version->commitTs > ts) {
+    version = version->older.load(std::memory_order_acquire);
+  }
+  if (version == nullptr || version->deleted) {
+    return nullptr;
+  }
+  return &version->value;
+}
@@ -0,0 +1,135 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "Benchmark.h"
+#include "Record.h"
+#include "VersionedStore.h"
+
+using std::cout;
+using std::endl;
+
+const int kRecords = 100000;
+const int kReadsPerSnapshot = 4;
+const std::chrono::milliseconds kRunTime(500);
+
+struct RunResult {
+  uint64_t operations;
+  double seconds;
+};
+
+// Every thread loops until the deadline; a read opens a snapshot and looks up
+// a few random records, a write bumps the quantity of one random record
+RunResult run(VersionedStore<ProductRecord>& store, int threads,
+              int writePercent) {
+  std::atomic<bool> start(false), stop(false);
+  std::atomic<uint64_t> operations(0);
+  std::vector<std::thread> workers;
+
+  for (int t = 0; t < threads; t++) {
+    workers.emplace_back([&, t]() {
+      std::mt19937 gen(1234 + t);
+      std::uniform_int_distribution<int> pickId(0, kRecords - 1);
+      std::uniform_int_distribution<int> pickOp(0, 99);
+      uint64_t done = 0;
+      long checksum = 0;
+
+      while (!start.load()) {
+      }
+      while (!stop.load(std::memory_order_relaxed)) {
+        if (pickOp(gen) < writePercent) {
+          store.update(pickId(gen), [](ProductRecord& record) {
+            record.setQuantity(record.getQuantity() + 1);
+          });
+        } else {
+          VersionedStore<ProductRecord>::Snapshot snapshot = store.snapshot();
+          for (int i = 0; i < kReadsPerSnapshot; i++) {
+            const ProductRecord* record = snapshot.get(pickId(gen));
+            checksum += record->getQuantity();
+          }
+        }
+        done++;
+      }
+      doNotOptimize(checksum);
+      operations.fetch_add(done);
+    });
+  }
+
+  auto begin = std::chrono::steady_clock::now();
+  start.store(true);
+  std::this_thread::sleep_for(kRunTime);
+  stop.store(true);
+  for (std::thread& worker : workers) {
+    worker.join();
+  }
+  auto end = std::chrono::steady_clock::now();
+
+  return {operations.load(),
+          std::chrono::duration<double>(end - begin).count()};
+}
+
+// Deletes every record, then runs a collection pass of its own once any
+// background pass has finished: with no snapshot open, the tombstones and
+// the versions behind them must all be reclaimed
+bool deletionsReclaimed() {
+  VersionedStore<ProductRecord> store(kRecords);
+  for (int id = 0; id < kRecords; id++) {
+    store.insert(ProductRecord(id, "Product", 10.0, 0));
+    store.update(id, [](ProductRecord& record) { record.setQuantity(1); });
+    store.remove(id);
+  }
+  store.collectGarbage();
+  return store.versionCount() == 0;
+}
+
+// Usage: benchmark [max threads], defaults to the number of hardware threads
+int main(int argc, char* argv[]) {
+  VersionedStore<ProductRecord> store(kRecords);
+  for (int id = 0; id < kRecords; id++) {
+    store.insert(ProductRecord(id, "Product", 10.0, 0));
+  }
+
+  int maxThreads = argc > 1 ? std::atoi(argv[1])
+                            : std::thread::hardware_concurrency();
+  maxThreads = std::max(1, maxThreads);
+  std::vector<int> threadCounts;
+  for (int t = 1; t < maxThreads; t *= 2) {
+    threadCounts.push_back(t);
+  }
+  threadCounts.push_back(maxThreads);
+
+  cout << "MVCC read/write benchmark: " << kRecords << " records, "
+       << kReadsPerSnapshot << " reads per snapshot, " << kRunTime.count()
+       << " ms per run" << endl;
+  cout << std::fixed << std::setprecision(2);
+
+  for (int writePercent : {0, 10, 50}) {
+    cout << endl << "Writes: " << writePercent << "%" << endl;
+    cout << std::setw(8) << "threads" << std::setw(16) << "Mops/s"
+         << std::setw(12) << "speedup" << std::setw(12) << "versions"
+         << endl;
+
+    double single = 0;
+    for (int threads : threadCounts) {
+      RunResult result = run(store, threads, writePercent);
+      double rate = result.operations / result.seconds / 1e6;
+      if (threads == 1) {
+        single = rate;
+      }
+      cout << std::setw(8) << threads << std::setw(16) << rate << std::setw(12)
+           << rate / single << std::setw(12) << store.versionCount() << endl;
+    }
+  }
+
+  bool reclaimed = deletionsReclaimed();
+  cout << endl
+       << "Deleted records reclaimed: " << (reclaimed ? "yes" : "NO") << endl;
+  return reclaimed ? 0 : 1;
+}
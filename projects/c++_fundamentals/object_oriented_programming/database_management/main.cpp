@@ -1,61 +1,7 @@
-#include <ctime>
 #include <iostream>
-#include <string>
 
-class Record {
- protected:
-  int id;
-  std::time_t createdAt;
-  std::time_t updatedAt;
-
- public:
-  Record(int id) : id(id), createdAt(std::time(0)), updatedAt(std::time(0)) {}
-
-  virtual void save() {
-    std::cout << "Saving record with id: " << id << "\n";
-    updatedAt = std::time(0);
-  }
-
-  virtual void update() {
-    std::cout << "Updating record with id: " << id << "\n";
-    updatedAt = std::time(0);
-  }
-
-  virtual void deleteRecord() {
-    std::cout << "Deleting record with id: " << id << "\n";
-  }
-
-  int getId() const { return id; }
-
-  std::time_t getCreatedAt() const { return createdAt; }
-
-  std::time_t getUpdatedAt() const { return updatedAt; }
-};
-
-class UserRecord : public Record {
- private:
-  std::string name;
-  std::string email;
-  std::string password;
-
- public:
-  UserRecord(int id, std::string name, std::string email, std::string password)
-      : Record(id), name(name), email(email), password(password) {}
-};
-
-class ProductRecord : public Record {
- private:
-  std::string productName;
-  double price;
-  int quantity;
-
- public:
-  ProductRecord(int id, std::string productName, double price, int quantity)
-      : Record(id),
-        productName(productName),
-        price(price),
-        quantity(quantity) {}
-};
+#include "Record.h"
+#include "VersionedStore.h"
 
 int main() {
   UserRecord user(1, "John Doe", "johndoe@example.com", "password");
@@ -63,10 +9,30 @@ int main() {
   user.update();
   user.deleteRecord();
 
+  std::cout << "Stored password: " << user.getPasswordHash().toString() << "\n";
+  std::cout << "Login with 'password': "
+            << (user.checkPassword("password") ? "accepted" : "rejected")
+            << "\n";
+  std::cout << "Login with 'hunter2': "
+            << (user.checkPassword("hunter2") ? "accepted" : "rejected")
+            << "\n";
+
   ProductRecord product(2, "Product 1", 100.0, 10);
   product.save();
   product.update();
   product.deleteRecord();
 
+  VersionedStore<ProductRecord> store(8);
+  store.insert(product);
+
+  VersionedStore<ProductRecord>::Snapshot before = store.snapshot();
+  store.update(2, [](ProductRecord& record) { record.setQuantity(9); });
+  VersionedStore<ProductRecord>::Snapshot after = store.snapshot();
+
+  std::cout << "Quantity seen by the old snapshot: "
+            << before.get(2)->getQuantity() << "\n";
+  std::cout << "Quantity seen by the new snapshot: "
+            << after.get(2)->getQuantity() << "\n";
+
   return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,126 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "PasswordHash.h"
+#include "PasswordVerifier.h"
+#include "Record.h"
+
+using std::cout;
+using std::endl;
+
+const int kUsers = 64;
+const int kAttemptsPerThread = 16;
+
+struct TestVector {
+  const char* password;
+  const char* salt;
+  ScryptParams params;
+  const char* hex;
+};
+
+// From RFC 7914, section 12
+const TestVector kVectors[] = {
+    {"", "", {16, 1, 1},
+     "77d6576238657b203b19ca42c18a0497f16b4844e3074ae8dfdffa3fede21442"
+     "fcd0069ded0948f8326a753a0fc81f17e8d3e0fb2e0d3628cf35e20c38d18906"},
+    {"password", "NaCl", {1024, 8, 16},
+     "fdbabe1c9d3472007856e7190d01e9fe7c6ad7cbc8237830e77376634b373162"
+     "2eaf30d92e22a3886ff109279d9830dac727afb94a83ee6d8360cbdfa2cc0640"}};
+
+bool matchesTestVectors() {
+  bool allMatch = true;
+  for (const TestVector& vector : kVectors) {
+    std::string salt = vector.salt;
+    std::vector<uint8_t> out = scrypt(
+        vector.password, std::vector<uint8_t>(salt.begin(), salt.end()),
+        vector.params, 64);
+    std::string hex;
+    for (uint8_t byte : out) {
+      hex += "0123456789abcdef"[byte >> 4];
+      hex += "0123456789abcdef"[byte & 15];
+    }
+    if (hex != vector.hex) {
+      cout << "scrypt(\"" << vector.password << "\", \"" << vector.salt
+           << "\", n=" << vector.params.n << ") does not match RFC 7914"
+           << endl;
+      allMatch = false;
+    }
+  }
+  return allMatch;
+}
+
+// Usage: passwordBenchmark [latency budget in ms] [max threads]
+int main(int argc, char* argv[]) {
+  int budgetMs = argc > 1 ? std::atoi(argv[1]) : 50;
+  int maxThreads = argc > 2 ? std::atoi(argv[2])
+                            : std::thread::hardware_concurrency();
+  maxThreads = std::max(1, maxThreads);
+  std::chrono::microseconds budget(budgetMs * 1000);
+
+  if (!matchesTestVectors()) {
+    return 1;
+  }
+  cout << "scrypt matches the RFC 7914 test vectors" << endl;
+
+  ScryptParams params = calibrateScrypt(budget);
+  cout << "scrypt parameters for a " << budgetMs << " ms budget: n=" << params.n
+       << " r=" << params.r << " p=" << params.p << " ("
+       << params.memoryBytes() / 1024 << " KiB per check)" << endl;
+
+  std::vector<UserRecord> users;
+  for (int id = 0; id < kUsers; id++) {
+    users.emplace_back(id, "user", "user@example.com",
+                       "secret-" + std::to_string(id), params);
+  }
+
+  cout << endl
+       << std::setw(8) << "threads" << std::setw(14) << "checks/s"
+       << std::setw(18) << "checks/s/core" << std::setw(16) << "slowest ms"
+       << std::setw(14) << "over budget" << endl;
+  cout << std::fixed << std::setprecision(2);
+
+  std::vector<int> threadCounts;
+  for (int t = 1; t < maxThreads; t *= 2) {
+    threadCounts.push_back(t);
+  }
+  threadCounts.push_back(maxThreads);
+
+  for (int threads : threadCounts) {
+    PasswordVerifier verifier(threads, budget);
+
+    // Every other attempt uses the wrong password
+    std::vector<LoginAttempt> attempts;
+    for (int i = 0; i < threads * kAttemptsPerThread; i++) {
+      const UserRecord& user = users[i % kUsers];
+      std::string guess = "secret-" + std::to_string(user.getId());
+      attempts.push_back({&user.getPasswordHash(), i % 2 ? guess : "wrong"});
+    }
+
+    auto begin = std::chrono::steady_clock::now();
+    BatchResult result = verifier.verifyBatch(attempts);
+    double seconds = std::chrono::duration<double>(
+                         std::chrono::steady_clock::now() - begin)
+                         .count();
+
+    size_t accepted =
+        std::count(result.accepted.begin(), result.accepted.end(), true);
+    if (accepted != attempts.size() / 2) {
+      cout << "Verification mismatch: " << accepted << " accepted" << endl;
+      return 1;
+    }
+
+    double rate = attempts.size() / seconds;
+    cout << std::setw(8) << threads << std::setw(14) << rate << std::setw(18)
+         << rate / threads << std::setw(16)
+         << result.slowestCheck.count() / 1000.0 << std::setw(14)
+         << result.overBudget << endl;
+  }
+
+  return 0;
+}
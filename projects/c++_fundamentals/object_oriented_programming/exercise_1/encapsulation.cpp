@@ -17,7 +17,7 @@ class Person {
   void setAddress(std::string newAddress) { address = newAddress; }
   void setName(std::string newName) { name = newName; }
   Person(std::string n, int a, std::string addr = "")
-      : name(n), age(a), address(addr) {}
+      : name(n), address(addr), age(a) {}
 };
 
 int main() {
@@ -6,7 +6,7 @@ using std::cout;
 using std::endl;
 
 Person::Person(std::string n, int a, std::string addr)
-    : name(n), age(a), address(addr) {}
+    : name(n), address(addr), age(a) {}
 
 void Person::showData() {
   cout << name << " -- " << age << " -- " << address << endl;
@@ -0,0 +1,269 @@
+#include "Collision.h"
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <thread>
+
+namespace {
+
+float cross(Point2 a, Point2 b) { return a.x * b.y - a.y * b.x; }
+
+Point2 sub(Point2 a, Point2 b) { return {a.x - b.x, a.y - b.y}; }
+
+float dot(Point2 a, Point2 b) { return a.x * b.x + a.y * b.y; }
+
+// Counter-clockwise convex polygon contains point (edges included)
+bool containsPoint(const Point2* polygon, int count, Point2 point) {
+  for (int i = 0; i < count; i++) {
+    Point2 edge = sub(polygon[(i + 1) % count], polygon[i]);
+    if (cross(edge, sub(point, polygon[i])) < 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+float distanceSquaredToSegment(Point2 point, Point2 a, Point2 b) {
+  Point2 segment = sub(b, a);
+  Point2 offset = sub(point, a);
+  float length = dot(segment, segment);
+  float t = length > 0 ? dot(offset, segment) / length : 0;
+  t = std::max(0.0f, std::min(1.0f, t));
+  Point2 closest = {a.x + segment.x * t, a.y + segment.y * t};
+  Point2 gap = sub(point, closest);
+  return dot(gap, gap);
+}
+
+bool circleCircle(const Circle& a, const Circle& b) {
+  float dx = a.getX() - b.getX();
+  float dy = a.getY() - b.getY();
+  float reach = a.getRadius() + b.getRadius();
+  return dx * dx + dy * dy <= reach * reach;
+}
+
+bool circlePolygon(const Circle& circle, const Shape& polygon) {
+  Point2 corners[Shape::kMaxVertices];
+  int count = polygon.vertices(corners);
+  Point2 center = {circle.getX(), circle.getY()};
+  if (containsPoint(corners, count, center)) {
+    return true;
+  }
+  float radiusSquared = circle.getRadius() * circle.getRadius();
+  for (int i = 0; i < count; i++) {
+    if (distanceSquaredToSegment(center, corners[i],
+                                 corners[(i + 1) % count]) <= radiusSquared) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// True if some edge normal of first separates the two polygons
+bool hasSeparatingAxis(const Point2* first, int firstCount,
+                       const Point2* second, int secondCount) {
+  for (int i = 0; i < firstCount; i++) {
+    Point2 edge = sub(first[(i + 1) % firstCount], first[i]);
+    Point2 axis = {-edge.y, edge.x};
+    float minFirst = dot(axis, first[0]), maxFirst = minFirst;
+    for (int k = 1; k < firstCount; k++) {
+      float projection = dot(axis, first[k]);
+      minFirst = std::min(minFirst, projection);
+      maxFirst = std::max(maxFirst, projection);
+    }
+    float minSecond = dot(axis, second[0]), maxSecond = minSecond;
+    for (int k = 1; k < secondCount; k++) {
+      float projection = dot(axis, second[k]);
+      minSecond = std::min(minSecond, projection);
+      maxSecond = std::max(maxSecond, projection);
+    }
+    if (maxFirst < minSecond || maxSecond < minFirst) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Separating axis test for two convex polygons
+bool polygonPolygon(const Shape& a, const Shape& b) {
+  Point2 first[Shape::kMaxVertices], second[Shape::kMaxVertices];
+  int firstCount = a.vertices(first);
+  int secondCount = b.vertices(second);
+  return !hasSeparatingAxis(first, firstCount, second, secondCount) &&
+         !hasSeparatingAxis(second, secondCount, first, firstCount);
+}
+
+void testRange(const std::vector<Shape*>& shapes,
+               const std::vector<CollisionPair>& candidates, size_t begin,
+               size_t end, std::vector<CollisionPair>& hits) {
+  for (size_t i = begin; i < end; i++) {
+    const CollisionPair& pair = candidates[i];
+    if (intersects(*shapes[pair.first], *shapes[pair.second])) {
+      hits.push_back(pair);
+    }
+  }
+}
+
+}  // namespace
+
+bool intersects(const Shape& a, const Shape& b) {
+  if (!a.bounds().overlaps(b.bounds())) {
+    return false;
+  }
+  bool aCircle = a.kind() == ShapeKind::Circle;
+  bool bCircle = b.kind() == ShapeKind::Circle;
+  if (aCircle && bCircle) {
+    return circleCircle(static_cast<const Circle&>(a),
+                        static_cast<const Circle&>(b));
+  }
+  if (aCircle) {
+    return circlePolygon(static_cast<const Circle&>(a), b);
+  }
+  if (bCircle) {
+    return circlePolygon(static_cast<const Circle&>(b), a);
+  }
+  // Two axis-aligned rectangles overlap exactly when their boxes do
+  if (a.kind() == ShapeKind::Rectangle && b.kind() == ShapeKind::Rectangle) {
+    return true;
+  }
+  return polygonPolygon(a, b);
+}
+
+void SweepAndPrune::sortByMinX() {
+  auto byMinX = [this](int a, int b) { return boxes[a].minX < boxes[b].minX; };
+  if (order.size() != boxes.size()) {
+    order.resize(boxes.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), byMinX);
+    return;
+  }
+  for (size_t i = 1; i < order.size(); i++) {
+    int moving = order[i];
+    size_t j = i;
+    while (j > 0 && byMinX(moving, order[j - 1])) {
+      order[j] = order[j - 1];
+      j--;
+    }
+    order[j] = moving;
+  }
+}
+
+void SweepAndPrune::sweepBand(int band, float bottom, float bandHeight) {
+  const int* begin = bandShapes.data() + bandStart[band];
+  const int* end = bandShapes.data() + bandStart[band + 1];
+  for (const int* i = begin; i != end; i++) {
+    const Bounds& box = boxes[*i];
+    for (const int* j = i + 1; j != end; j++) {
+      const Bounds& other = boxes[*j];
+      if (other.minX > box.maxX) {
+        break;
+      }
+      if (other.minY > box.maxY || box.minY > other.maxY) {
+        continue;
+      }
+      // A pair that spans several bands is reported only by the band
+      // holding the bottom of their overlap
+      float overlapBottom = std::max(box.minY, other.minY);
+      int home = std::min(int((overlapBottom - bottom) / bandHeight),
+                          int(bandStart.size()) - 2);
+      if (home == band) {
+        candidates.push_back({std::min(*i, *j), std::max(*i, *j)});
+      }
+    }
+  }
+}
+
+const std::vector<CollisionPair>& SweepAndPrune::update(
+    const std::vector<Shape*>& shapes) {
+  candidates.clear();
+  boxes.resize(shapes.size());
+  if (shapes.empty()) {
+    return candidates;
+  }
+  float bottom = 0, top = 0, totalHeight = 0;
+  for (size_t i = 0; i < shapes.size(); i++) {
+    boxes[i] = shapes[i]->bounds();
+    bottom = i == 0 ? boxes[i].minY : std::min(bottom, boxes[i].minY);
+    top = i == 0 ? boxes[i].maxY : std::max(top, boxes[i].maxY);
+    totalHeight += boxes[i].maxY - boxes[i].minY;
+  }
+  sortByMinX();
+
+  // Bands about four average shapes tall: most shapes sit in one band, and
+  // each band holds only a thin slice of the world
+  float averageHeight = totalHeight / shapes.size();
+  float extent = top - bottom;
+  int bands = 1;
+  if (averageHeight > 0 && extent > 0) {
+    float wanted = extent / (4 * averageHeight);
+    bands = int(std::min(4096.0f, std::max(1.0f, wanted)));
+  }
+  float bandHeight = extent > 0 ? extent / bands : 1;
+  auto bandOf = [&](float y) {
+    return std::min(int((y - bottom) / bandHeight), bands - 1);
+  };
+
+  // Distribute shapes into bands in x order, so each band stays sorted
+  bandStart.assign(bands + 1, 0);
+  for (int shape : order) {
+    for (int b = bandOf(boxes[shape].minY); b <= bandOf(boxes[shape].maxY);
+         b++) {
+      bandStart[b + 1]++;
+    }
+  }
+  for (int b = 0; b < bands; b++) {
+    bandStart[b + 1] += bandStart[b];
+  }
+  bandShapes.resize(bandStart[bands]);
+  std::vector<int> fill(bandStart.begin(), bandStart.end() - 1);
+  for (int shape : order) {
+    for (int b = bandOf(boxes[shape].minY); b <= bandOf(boxes[shape].maxY);
+         b++) {
+      bandShapes[fill[b]++] = shape;
+    }
+  }
+
+  for (int b = 0; b < bands; b++) {
+    sweepBand(b, bottom, bandHeight);
+  }
+  return candidates;
+}
+
+std::vector<CollisionPair> testPairs(
+    const std::vector<Shape*>& shapes,
+    const std::vector<CollisionPair>& candidates, int threads) {
+  size_t workers = std::max(1, threads);
+  workers = std::min(workers, std::max<size_t>(1, candidates.size() / 1024));
+  std::vector<std::vector<CollisionPair>> hits(workers);
+  std::vector<std::thread> pool;
+  size_t chunk = (candidates.size() + workers - 1) / workers;
+  for (size_t w = 1; w < workers; w++) {
+    size_t begin = std::min(candidates.size(), w * chunk);
+    size_t end = std::min(candidates.size(), begin + chunk);
+    pool.emplace_back(testRange, std::cref(shapes), std::cref(candidates),
+                      begin, end, std::ref(hits[w]));
+  }
+  testRange(shapes, candidates, 0, std::min(candidates.size(), chunk),
+            hits[0]);
+  for (std::thread& worker : pool) {
+    worker.join();
+  }
+
+  std::vector<CollisionPair> result = std::move(hits[0]);
+  for (size_t w = 1; w < workers; w++) {
+    result.insert(result.end(), hits[w].begin(), hits[w].end());
+  }
+  return result;
+}
+
+std::vector<CollisionPair> bruteForcePairs(const std::vector<Shape*>& shapes) {
+  std::vector<CollisionPair> result;
+  for (size_t i = 0; i < shapes.size(); i++) {
+    for (size_t j = i + 1; j < shapes.size(); j++) {
+      if (intersects(*shapes[i], *shapes[j])) {
+        result.push_back({int(i), int(j)});
+      }
+    }
+  }
+  return result;
+}
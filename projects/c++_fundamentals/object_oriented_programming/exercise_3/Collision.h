@@ -0,0 +1,50 @@
+#ifndef COLLISION_H
+#define COLLISION_H
+
+#include <vector>
+
+#include "Shape.h"
+
+// Two shapes by their index in the shape list, first < second
+struct CollisionPair {
+  int first, second;
+};
+
+// Narrowphase: exact overlap test for any two shapes. Touching counts as
+// overlapping.
+bool intersects(const Shape& a, const Shape& b);
+
+// Broadphase: finds every pair whose bounding boxes overlap by sorting the
+// boxes along x and sweeping. A single sweep over a wide, evenly filled world
+// compares each shape with everything in its vertical strip, so the world is
+// cut into horizontal bands (a few shapes tall) and each band is swept on its
+// own. The x order is kept between updates; shapes move only a little per
+// frame, so re-sorting is an insertion sort over an almost sorted list.
+class SweepAndPrune {
+ private:
+  std::vector<Bounds> boxes;
+  std::vector<int> order;
+  std::vector<int> bandStart;
+  std::vector<int> bandShapes;
+  std::vector<CollisionPair> candidates;
+
+  void sortByMinX();
+  void sweepBand(int band, float bottom, float bandHeight);
+
+ public:
+  // Candidate pairs for the shapes' current positions. The reference stays
+  // valid until the next call.
+  const std::vector<CollisionPair>& update(const std::vector<Shape*>& shapes);
+};
+
+// Runs the narrowphase over candidates split across threads and returns the
+// pairs that really overlap, in candidate order
+std::vector<CollisionPair> testPairs(
+    const std::vector<Shape*>& shapes,
+    const std::vector<CollisionPair>& candidates, int threads = 1);
+
+// Every overlapping pair by testing all n^2 / 2 pairs; for checking the
+// broadphase
+std::vector<CollisionPair> bruteForcePairs(const std::vector<Shape*>& shapes);
+
+#endif
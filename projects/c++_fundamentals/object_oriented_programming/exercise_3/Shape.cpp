@@ -1,15 +1,28 @@
 #include "Shape.h"
 
+#define _USE_MATH_DEFINES
+#include <cmath>
 #include <iostream>
 #include <string>
 
 using std::cout;
 using std::endl;
 
-Shape::Shape(std::string type) : type(type) {}
+Shape::Shape(std::string type, ShapeKind kind, float x, float y)
+    : type(type), shapeKind(kind), x(x), y(y) {}
 
-void Shape::getArea() {}
-void Shape::getPerimeter() {}
+void Shape::getArea() { printArea(area()); }
+void Shape::getPerimeter() { printPerimeter(perimeter()); }
+
+void Shape::setPosition(float x, float y) {
+  this->x = x;
+  this->y = y;
+}
+
+void Shape::move(float dx, float dy) {
+  x += dx;
+  y += dy;
+}
 
 void Shape::printPerimeter(float perimeter) {
   cout << "Perimeter of " << type << ": " << perimeter << endl;
@@ -17,4 +30,63 @@ void Shape::printPerimeter(float perimeter) {
 
 void Shape::printArea(float area) {
   cout << "Area of " << type << ": " << area << endl;
-}
\ No newline at end of file
+}
+
+Rectangle::Rectangle(float width, float height, float x, float y)
+    : Shape("rectangle", ShapeKind::Rectangle, x, y),
+      width(width),
+      height(height) {}
+
+float Rectangle::area() const { return width * height; }
+
+float Rectangle::perimeter() const { return 2 * (width + height); }
+
+Bounds Rectangle::bounds() const {
+  return {x - width / 2, y - height / 2, x + width / 2, y + height / 2};
+}
+
+int Rectangle::vertices(Point2 out[kMaxVertices]) const {
+  Bounds box = bounds();
+  out[0] = {box.minX, box.minY};
+  out[1] = {box.maxX, box.minY};
+  out[2] = {box.maxX, box.maxY};
+  out[3] = {box.minX, box.maxY};
+  return 4;
+}
+
+Circle::Circle(float radius, float x, float y)
+    : Shape("circle", ShapeKind::Circle, x, y), radius(radius) {}
+
+float Circle::area() const { return M_PI * (radius * radius); }
+
+float Circle::perimeter() const { return 2 * M_PI * radius; }
+
+Bounds Circle::bounds() const {
+  return {x - radius, y - radius, x + radius, y + radius};
+}
+
+int Circle::vertices(Point2[kMaxVertices]) const { return 0; }
+
+Triangle::Triangle(float base, float height, float x, float y)
+    : Shape("triangle", ShapeKind::Triangle, x, y),
+      base(base),
+      height(height) {}
+
+float Triangle::area() const { return (base * height) / 2; }
+
+float Triangle::perimeter() const {
+  float hypotenuse = sqrtf((base * base) + (height * height));
+  return hypotenuse + base + height;
+}
+
+Bounds Triangle::bounds() const {
+  return {x - base / 2, y - height / 2, x + base / 2, y + height / 2};
+}
+
+int Triangle::vertices(Point2 out[kMaxVertices]) const {
+  Bounds box = bounds();
+  out[0] = {box.minX, box.minY};
+  out[1] = {box.maxX, box.minY};
+  out[2] = {box.minX, box.maxY};
+  return 3;
+}
@@ -3,19 +3,105 @@
 
 #include <string>
 
+struct Point2 {
+  float x, y;
+};
+
+// Axis-aligned bounding box
+struct Bounds {
+  float minX, minY, maxX, maxY;
+
+  bool overlaps(const Bounds& other) const {
+    return minX <= other.maxX && other.minX <= maxX && minY <= other.maxY &&
+           other.minY <= maxY;
+  }
+};
+
+enum class ShapeKind { Rectangle, Circle, Triangle };
+
+// Every shape is placed by the centre of its bounding box
 class Shape {
  private:
   std::string type;
+  ShapeKind shapeKind;
 
  protected:
+  float x, y;
+
   void printPerimeter(float perimeter);
   void printArea(float area);
 
  public:
-  Shape(std::string type);
+  static const int kMaxVertices = 4;
+
+  Shape(std::string type, ShapeKind kind, float x = 0, float y = 0);
+  virtual ~Shape() {}
+
+  virtual float area() const = 0;
+  virtual float perimeter() const = 0;
+  virtual Bounds bounds() const = 0;
+  // Writes the corners counter-clockwise and returns how many there are;
+  // curved shapes return 0
+  virtual int vertices(Point2 out[kMaxVertices]) const = 0;
+
+  void getPerimeter();
+  void getArea();
+
+  ShapeKind kind() const { return shapeKind; }
+  const std::string& getType() const { return type; }
+  float getX() const { return x; }
+  float getY() const { return y; }
+  void setPosition(float x, float y);
+  void move(float dx, float dy);
+};
+
+class Rectangle : public Shape {
+ private:
+  float width, height;
+
+ public:
+  Rectangle(float width, float height, float x = 0, float y = 0);
+
+  float getWidth() const { return width; }
+  float getHeight() const { return height; }
+
+  float area() const override;
+  float perimeter() const override;
+  Bounds bounds() const override;
+  int vertices(Point2 out[kMaxVertices]) const override;
+};
+
+class Circle : public Shape {
+ private:
+  float radius;
+
+ public:
+  Circle(float radius, float x = 0, float y = 0);
+
+  float getRadius() const { return radius; }
+
+  float area() const override;
+  float perimeter() const override;
+  Bounds bounds() const override;
+  int vertices(Point2 out[kMaxVertices]) const override;
+};
+
+// Right triangle: the right angle is at the bottom-left corner of its
+// bounding box, with base along x and height along y
+class Triangle : public Shape {
+ private:
+  float base, height;
+
+ public:
+  Triangle(float base, float height, float x = 0, float y = 0);
+
+  float getBase() const { return base; }
+  float getHeight() const { return height; }
 
-  virtual void getPerimeter() = 0;
-  virtual void getArea() = 0;
+  float area() const override;
+  float perimeter() const override;
+  Bounds bounds() const override;
+  int vertices(Point2 out[kMaxVertices]) const override;
 };
 
 #endif
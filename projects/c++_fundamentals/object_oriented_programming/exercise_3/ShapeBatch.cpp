@@ -0,0 +1,196 @@
+#include "ShapeBatch.h"
+
+#define _USE_MATH_DEFINES
+#include <cmath>
+
+#include "../exercise_4/VecMath.h"
+
+typedef SimdPack<float> Wide;
+
+float CircleValue::area() const { return M_PI * (radius * radius); }
+
+float CircleValue::perimeter() const { return 2 * M_PI * radius; }
+
+float TriangleValue::perimeter() const {
+  float hypotenuse = sqrtf((base * base) + (height * height));
+  return hypotenuse + base + height;
+}
+
+ShapeVariant toVariant(const Shape& shape) {
+  switch (shape.kind()) {
+    case ShapeKind::Rectangle: {
+      const Rectangle& r = static_cast<const Rectangle&>(shape);
+      return RectangleValue{r.getWidth(), r.getHeight(), r.getX(), r.getY()};
+    }
+    case ShapeKind::Circle: {
+      const Circle& c = static_cast<const Circle&>(shape);
+      return CircleValue{c.getRadius(), c.getX(), c.getY()};
+    }
+    default: {
+      const Triangle& t = static_cast<const Triangle&>(shape);
+      return TriangleValue{t.getBase(), t.getHeight(), t.getX(), t.getY()};
+    }
+  }
+}
+
+float area(const ShapeVariant& shape) {
+  return std::visit([](const auto& s) { return s.area(); }, shape);
+}
+
+float perimeter(const ShapeVariant& shape) {
+  return std::visit([](const auto& s) { return s.perimeter(); }, shape);
+}
+
+void computeAll(const std::vector<ShapeVariant>& shapes,
+                std::vector<float>& areas, std::vector<float>& perimeters) {
+  areas.resize(shapes.size());
+  perimeters.resize(shapes.size());
+  for (size_t i = 0; i < shapes.size(); i++) {
+    std::visit(
+        [&](const auto& s) {
+          areas[i] = s.area();
+          perimeters[i] = s.perimeter();
+        },
+        shapes[i]);
+  }
+}
+
+void ShapeBatch::add(const RectangleValue& rectangle) {
+  rectWidth.push_back(rectangle.width);
+  rectHeight.push_back(rectangle.height);
+  rectX.push_back(rectangle.x);
+  rectY.push_back(rectangle.y);
+}
+
+void ShapeBatch::add(const CircleValue& circle) {
+  circleRadius.push_back(circle.radius);
+  circleX.push_back(circle.x);
+  circleY.push_back(circle.y);
+}
+
+void ShapeBatch::add(const TriangleValue& triangle) {
+  triBase.push_back(triangle.base);
+  triHeight.push_back(triangle.height);
+  triX.push_back(triangle.x);
+  triY.push_back(triangle.y);
+}
+
+void ShapeBatch::add(const ShapeVariant& shape) {
+  std::visit([this](const auto& s) { add(s); }, shape);
+}
+
+void ShapeBatch::add(const Shape& shape) { add(toVariant(shape)); }
+
+void ShapeBatch::clear() {
+  for (std::vector<float>* field :
+       {&rectWidth, &rectHeight, &rectX, &rectY, &circleRadius, &circleX,
+        &circleY, &triBase, &triHeight, &triX, &triY}) {
+    field->clear();
+  }
+}
+
+void ShapeBatch::reserve(size_t rectangles, size_t circles,
+                         size_t triangles) {
+  for (std::vector<float>* field : {&rectWidth, &rectHeight, &rectX, &rectY}) {
+    field->reserve(rectangles);
+  }
+  for (std::vector<float>* field : {&circleRadius, &circleX, &circleY}) {
+    field->reserve(circles);
+  }
+  for (std::vector<float>* field : {&triBase, &triHeight, &triX, &triY}) {
+    field->reserve(triangles);
+  }
+}
+
+void ShapeBatch::computeAreas(std::vector<float>& areas) const {
+  areas.resize(size());
+  float* out = areas.data();
+
+  size_t n = rectangles(), i = 0;
+  for (; i + Wide::width <= n; i += Wide::width) {
+    (Wide::load(&rectWidth[i]) * Wide::load(&rectHeight[i])).store(out + i);
+  }
+  for (; i < n; i++) {
+    out[i] = rectWidth[i] * rectHeight[i];
+  }
+  out += n;
+
+  const float pi = M_PI;
+  Wide piWide = Wide::broadcast(pi);
+  n = circles(), i = 0;
+  for (; i + Wide::width <= n; i += Wide::width) {
+    Wide r = Wide::load(&circleRadius[i]);
+    (piWide * (r * r)).store(out + i);
+  }
+  for (; i < n; i++) {
+    out[i] = pi * (circleRadius[i] * circleRadius[i]);
+  }
+  out += n;
+
+  Wide half = Wide::broadcast(0.5f);
+  n = triangles(), i = 0;
+  for (; i + Wide::width <= n; i += Wide::width) {
+    (Wide::load(&triBase[i]) * Wide::load(&triHeight[i]) * half)
+        .store(out + i);
+  }
+  for (; i < n; i++) {
+    out[i] = triBase[i] * triHeight[i] * 0.5f;
+  }
+}
+
+void ShapeBatch::computePerimeters(std::vector<float>& perimeters) const {
+  perimeters.resize(size());
+  float* out = perimeters.data();
+
+  Wide two = Wide::broadcast(2.0f);
+  size_t n = rectangles(), i = 0;
+  for (; i + Wide::width <= n; i += Wide::width) {
+    (two * (Wide::load(&rectWidth[i]) + Wide::load(&rectHeight[i])))
+        .store(out + i);
+  }
+  for (; i < n; i++) {
+    out[i] = 2 * (rectWidth[i] + rectHeight[i]);
+  }
+  out += n;
+
+  const float tau = 2 * M_PI;
+  Wide tauWide = Wide::broadcast(tau);
+  n = circles(), i = 0;
+  for (; i + Wide::width <= n; i += Wide::width) {
+    (tauWide * Wide::load(&circleRadius[i])).store(out + i);
+  }
+  for (; i < n; i++) {
+    out[i] = tau * circleRadius[i];
+  }
+  out += n;
+
+  n = triangles(), i = 0;
+  for (; i + Wide::width <= n; i += Wide::width) {
+    Wide b = Wide::load(&triBase[i]), h = Wide::load(&triHeight[i]);
+    ((b * b + h * h).sqrt() + b + h).store(out + i);
+  }
+  for (; i < n; i++) {
+    float b = triBase[i], h = triHeight[i];
+    out[i] = sqrtf(b * b + h * h) + b + h;
+  }
+}
+
+double ShapeBatch::totalArea() const {
+  std::vector<float> areas;
+  computeAreas(areas);
+  double total = 0;
+  for (float a : areas) {
+    total += a;
+  }
+  return total;
+}
+
+double ShapeBatch::totalPerimeter() const {
+  std::vector<float> perimeters;
+  computePerimeters(perimeters);
+  double total = 0;
+  for (float p : perimeters) {
+    total += p;
+  }
+  return total;
+}
@@ -0,0 +1,77 @@
+#ifndef SHAPE_BATCH_H
+#define SHAPE_BATCH_H
+
+#include <cstddef>
+#include <variant>
+#include <vector>
+
+#include "Shape.h"
+
+// Plain value versions of the shapes: no vtable, no type string, and area
+// and perimeter that the compiler can inline
+struct RectangleValue {
+  float width, height, x, y;
+
+  float area() const { return width * height; }
+  float perimeter() const { return 2 * (width + height); }
+};
+
+struct CircleValue {
+  float radius, x, y;
+
+  float area() const;
+  float perimeter() const;
+};
+
+struct TriangleValue {
+  float base, height, x, y;
+
+  float area() const { return (base * height) / 2; }
+  float perimeter() const;
+};
+
+// Closed set of shapes dispatched with std::visit instead of a vtable
+typedef std::variant<RectangleValue, CircleValue, TriangleValue> ShapeVariant;
+
+ShapeVariant toVariant(const Shape& shape);
+
+float area(const ShapeVariant& shape);
+float perimeter(const ShapeVariant& shape);
+
+// Writes area and perimeter of shapes[i] to areas[i] and perimeters[i]
+void computeAll(const std::vector<ShapeVariant>& shapes,
+                std::vector<float>& areas, std::vector<float>& perimeters);
+
+// Shapes grouped by kind, each kind stored as one array per field, so area
+// and perimeter run as SIMD loops with no per-shape dispatch at all.
+// Results come out grouped the same way: every rectangle in insertion
+// order, then every circle, then every triangle.
+class ShapeBatch {
+ private:
+  std::vector<float> rectWidth, rectHeight, rectX, rectY;
+  std::vector<float> circleRadius, circleX, circleY;
+  std::vector<float> triBase, triHeight, triX, triY;
+
+ public:
+  void add(const RectangleValue& rectangle);
+  void add(const CircleValue& circle);
+  void add(const TriangleValue& triangle);
+  void add(const ShapeVariant& shape);
+  void add(const Shape& shape);
+
+  size_t rectangles() const { return rectWidth.size(); }
+  size_t circles() const { return circleRadius.size(); }
+  size_t triangles() const { return triBase.size(); }
+  size_t size() const { return rectangles() + circles() + triangles(); }
+  void clear();
+  void reserve(size_t rectangles, size_t circles, size_t triangles);
+
+  // Fills areas/perimeters (resized to size()) in batch order
+  void computeAreas(std::vector<float>& areas) const;
+  void computePerimeters(std::vector<float>& perimeters) const;
+
+  double totalArea() const;
+  double totalPerimeter() const;
+};
+
+#endif
@@ -0,0 +1,111 @@
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Shape.h"
+#include "ShapeBatch.h"
+
+using std::cout;
+using std::endl;
+
+const int kRepeats = 20;
+
+template <typename Function>
+double nanosecondsPerShape(size_t count, Function run) {
+  auto begin = std::chrono::steady_clock::now();
+  for (int r = 0; r < kRepeats; r++) {
+    run();
+  }
+  return std::chrono::duration<double, std::nano>(
+             std::chrono::steady_clock::now() - begin)
+             .count() /
+         (static_cast<double>(count) * kRepeats);
+}
+
+double sum(const std::vector<float>& values) {
+  double total = 0;
+  for (float v : values) {
+    total += v;
+  }
+  return total;
+}
+
+void printRow(const std::string& name, double ns, double baseline,
+              double areaSum, double perimeterSum) {
+  cout << std::setw(26) << name << std::setw(12) << ns << std::setw(10)
+       << baseline / ns << std::setw(18) << areaSum << std::setw(18)
+       << perimeterSum << endl;
+}
+
+// Area and perimeter of every shape in a mixed list, three ways
+int main(int argc, char* argv[]) {
+  size_t count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<float> size(0.5f, 4.0f);
+  std::uniform_int_distribution<int> kind(0, 2);
+  std::vector<std::unique_ptr<Shape>> shapes;
+  for (size_t i = 0; i < count; i++) {
+    switch (kind(rng)) {
+      case 0:
+        shapes.emplace_back(new Rectangle(size(rng), size(rng)));
+        break;
+      case 1:
+        shapes.emplace_back(new Circle(size(rng)));
+        break;
+      default:
+        shapes.emplace_back(new Triangle(size(rng), size(rng)));
+        break;
+    }
+  }
+  std::vector<ShapeVariant> variants;
+  ShapeBatch batch;
+  for (const std::unique_ptr<Shape>& shape : shapes) {
+    variants.push_back(toVariant(*shape));
+    batch.add(*shape);
+  }
+
+  cout << count << " shapes in random order, " << kRepeats << " passes"
+       << endl;
+  cout << std::fixed << std::setprecision(3);
+  cout << std::setw(26) << "dispatch" << std::setw(12) << "ns/shape"
+       << std::setw(10) << "speedup" << std::setw(18) << "area sum"
+       << std::setw(18) << "perimeter sum" << endl;
+
+  std::vector<float> areas(count), perimeters(count);
+  double virtualNs = nanosecondsPerShape(count, [&]() {
+    for (size_t i = 0; i < count; i++) {
+      areas[i] = shapes[i]->area();
+      perimeters[i] = shapes[i]->perimeter();
+    }
+  });
+  double virtualArea = sum(areas), virtualPerimeter = sum(perimeters);
+  printRow("virtual Shape*", virtualNs, virtualNs, virtualArea,
+           virtualPerimeter);
+
+  double variantNs = nanosecondsPerShape(
+      count, [&]() { computeAll(variants, areas, perimeters); });
+  printRow("std::variant + visit", variantNs, virtualNs, sum(areas),
+           sum(perimeters));
+
+  double batchNs = nanosecondsPerShape(count, [&]() {
+    batch.computeAreas(areas);
+    batch.computePerimeters(perimeters);
+  });
+  double batchArea = sum(areas), batchPerimeter = sum(perimeters);
+  printRow("ShapeBatch (SoA, SIMD)", batchNs, virtualNs, batchArea,
+           batchPerimeter);
+
+  // Float rounding differs slightly between the paths (pi as float vs double)
+  bool agree = std::abs(batchArea - virtualArea) < 1e-5 * virtualArea &&
+               std::abs(batchPerimeter - virtualPerimeter) <
+                   1e-5 * virtualPerimeter;
+  cout << "Results agree: " << (agree ? "yes" : "NO") << endl;
+  return agree ? 0 : 1;
+}
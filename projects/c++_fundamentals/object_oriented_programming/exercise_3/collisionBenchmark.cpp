@@ -0,0 +1,144 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "Collision.h"
+#include "Shape.h"
+
+using std::cout;
+using std::endl;
+
+const float kWorldSize = 1000;
+const int kFrames = 30;
+const int kCheckedShapes = 2000;
+
+struct Body {
+  std::unique_ptr<Shape> shape;
+  float vx, vy;
+};
+
+std::vector<Body> makeBodies(int count, float worldSize, unsigned seed) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<float> position(0, worldSize);
+  std::uniform_real_distribution<float> size(0.5f, 2.5f);
+  std::uniform_real_distribution<float> speed(-0.5f, 0.5f);
+  std::vector<Body> bodies;
+  for (int i = 0; i < count; i++) {
+    float x = position(rng), y = position(rng);
+    std::unique_ptr<Shape> shape;
+    switch (i % 3) {
+      case 0:
+        shape.reset(new Rectangle(size(rng), size(rng), x, y));
+        break;
+      case 1:
+        shape.reset(new Circle(size(rng) / 2, x, y));
+        break;
+      default:
+        shape.reset(new Triangle(size(rng), size(rng), x, y));
+        break;
+    }
+    bodies.push_back({std::move(shape), speed(rng), speed(rng)});
+  }
+  return bodies;
+}
+
+// Moves every body and bounces it off the world edges
+void step(std::vector<Body>& bodies, float worldSize) {
+  for (Body& body : bodies) {
+    body.shape->move(body.vx, body.vy);
+    float x = body.shape->getX(), y = body.shape->getY();
+    if (x < 0 || x > worldSize) body.vx = -body.vx;
+    if (y < 0 || y > worldSize) body.vy = -body.vy;
+  }
+}
+
+std::vector<Shape*> shapesOf(const std::vector<Body>& bodies) {
+  std::vector<Shape*> shapes;
+  for (const Body& body : bodies) {
+    shapes.push_back(body.shape.get());
+  }
+  return shapes;
+}
+
+bool samePairs(std::vector<CollisionPair> a, std::vector<CollisionPair> b) {
+  auto less = [](const CollisionPair& l, const CollisionPair& r) {
+    return l.first != r.first ? l.first < r.first : l.second < r.second;
+  };
+  std::sort(a.begin(), a.end(), less);
+  std::sort(b.begin(), b.end(), less);
+  return std::equal(a.begin(), a.end(), b.begin(), b.end(),
+                    [](const CollisionPair& l, const CollisionPair& r) {
+                      return l.first == r.first && l.second == r.second;
+                    });
+}
+
+// Usage: collisionBenchmark [shapes] [max threads]
+int main(int argc, char* argv[]) {
+  int count = argc > 1 ? std::atoi(argv[1]) : 100000;
+  int maxThreads = argc > 2 ? std::atoi(argv[2])
+                            : std::thread::hardware_concurrency();
+  maxThreads = std::max(1, maxThreads);
+
+  // Check the broadphase against testing every pair on a smaller world
+  std::vector<Body> checked = makeBodies(kCheckedShapes, 100, 7);
+  std::vector<Shape*> checkedShapes = shapesOf(checked);
+  SweepAndPrune checkedBroadphase;
+  for (int frame = 0; frame < 5; frame++) {
+    step(checked, 100);
+    std::vector<CollisionPair> fast =
+        testPairs(checkedShapes, checkedBroadphase.update(checkedShapes));
+    if (!samePairs(fast, bruteForcePairs(checkedShapes))) {
+      cout << "Sweep and prune disagrees with brute force" << endl;
+      return 1;
+    }
+  }
+  cout << "Sweep and prune matches brute force on " << kCheckedShapes
+       << " shapes" << endl;
+
+  std::vector<int> threadCounts;
+  for (int t = 1; t < maxThreads; t *= 2) {
+    threadCounts.push_back(t);
+  }
+  threadCounts.push_back(maxThreads);
+
+  cout << count << " moving shapes, " << kFrames << " frames" << endl;
+  cout << std::setw(8) << "threads" << std::setw(16) << "broadphase ms"
+       << std::setw(16) << "narrowphase ms" << std::setw(16) << "candidates/s"
+       << std::setw(12) << "hits/frame" << endl;
+  cout << std::fixed << std::setprecision(2);
+
+  for (int threads : threadCounts) {
+    std::vector<Body> bodies = makeBodies(count, kWorldSize, 42);
+    std::vector<Shape*> shapes = shapesOf(bodies);
+    SweepAndPrune broadphase;
+    broadphase.update(shapes);
+
+    double broadSeconds = 0, narrowSeconds = 0;
+    size_t candidateCount = 0, hitCount = 0;
+    for (int frame = 0; frame < kFrames; frame++) {
+      step(bodies, kWorldSize);
+      auto begin = std::chrono::steady_clock::now();
+      const std::vector<CollisionPair>& candidates = broadphase.update(shapes);
+      auto middle = std::chrono::steady_clock::now();
+      std::vector<CollisionPair> hits = testPairs(shapes, candidates, threads);
+      auto end = std::chrono::steady_clock::now();
+      broadSeconds += std::chrono::duration<double>(middle - begin).count();
+      narrowSeconds += std::chrono::duration<double>(end - middle).count();
+      candidateCount += candidates.size();
+      hitCount += hits.size();
+    }
+    cout << std::setw(8) << threads << std::setw(16)
+         << broadSeconds * 1000 / kFrames << std::setw(16)
+         << narrowSeconds * 1000 / kFrames << std::setw(16)
+         << std::setprecision(0) << candidateCount / narrowSeconds
+         << std::setw(12) << hitCount / kFrames << std::setprecision(2)
+         << endl;
+  }
+  return 0;
+}
@@ -1,53 +1,14 @@
-
-#define _USE_MATH_DEFINES
-#include <cmath>
 #include <iostream>
 #include <vector>
 
+#include "Collision.h"
 #include "Shape.h"
+#include "ShapeBatch.h"
 
 using std::cout;
 using std::endl;
 using std::vector;
 
-class Rectangle : public Shape {
- private:
-  float width, height;
-
- public:
-  Rectangle(float width, float height)
-      : Shape("rectangle"), width(width), height(height){};
-
-  void getPerimeter() { printPerimeter(2 * (width + height)); };
-  void getArea() { printArea(width * height); };
-};
-
-class Circle : public Shape {
-  float radius;
-
- public:
-  Circle(float radius) : Shape("circle"), radius(radius){};
-
-  void getPerimeter() { printPerimeter(2 * M_PI * radius); };
-  void getArea() { printArea(M_PI * (radius * radius)); };
-};
-
-class Triangle : public Shape {
- private:
-  float base, height;
-
- public:
-  Triangle(float base, float height)
-      : Shape("triangle"), base(base), height(height){};
-
-  void getPerimeter() {
-    float hypotenuse = sqrtf((base * base) + (height * height));
-    printPerimeter(hypotenuse + base + height);
-  };
-
-  void getArea() { printArea((base * height) / 2); };
-};
-
 int main() {
   Triangle t(3, 5);
   Rectangle r(2, 2);
@@ -65,5 +26,29 @@ int main() {
     cout << endl;
   }
 
+  // Same shapes as values, computed without virtual calls or printing
+  ShapeBatch batch;
+  for (Shape *shape : shapes) {
+    batch.add(*shape);
+  }
+  cout << "Total area: " << batch.totalArea()
+       << ", total perimeter: " << batch.totalPerimeter() << endl
+       << endl;
+
+  // Spread the shapes out and see which ones still touch
+  t.setPosition(0, 0);
+  r.setPosition(2, -1.5f);
+  c.setPosition(8, 0);
+
+  SweepAndPrune broadphase;
+  const vector<CollisionPair> &candidates = broadphase.update(shapes);
+  vector<CollisionPair> hits = testPairs(shapes, candidates);
+  cout << candidates.size() << " candidate pairs, " << hits.size()
+       << " colliding" << endl;
+  for (const CollisionPair &pair : hits) {
+    cout << shapes[pair.first]->getType() << " hits "
+         << shapes[pair.second]->getType() << endl;
+  }
+
   return 0;
 }
@@ -0,0 +1,573 @@
+#ifndef VEC_MATH_H
+#define VEC_MATH_H
+
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+// Header-only vector math: Vec2/Vec3/Vec4 over float or double, usable in
+// constant expressions, plus SIMD kernels over structure-of-arrays batches.
+//
+// Vec4 arithmetic uses SSE (float) or AVX (double) when the target has it
+// and the call is not being constant-evaluated; everything else is plain
+// inline code the compiler can fold and vectorize itself.
+
+#if defined(__GNUC__) || defined(__clang__)
+#define VEC_MATH_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#else
+#define VEC_MATH_CONSTANT_EVALUATED() true
+#endif
+
+template <typename T>
+struct Vec2 {
+  T x, y;
+
+  constexpr Vec2(T x = T(), T y = T()) : x(x), y(y) {}
+
+  constexpr Vec2 operator+(const Vec2& rhs) const {
+    return Vec2(x + rhs.x, y + rhs.y);
+  }
+  constexpr Vec2 operator-(const Vec2& rhs) const {
+    return Vec2(x - rhs.x, y - rhs.y);
+  }
+  constexpr Vec2 operator*(const Vec2& rhs) const {
+    return Vec2(x * rhs.x, y * rhs.y);
+  }
+  constexpr Vec2 operator*(T rhs) const { return Vec2(x * rhs, y * rhs); }
+  constexpr Vec2 operator/(T rhs) const { return Vec2(x / rhs, y / rhs); }
+  constexpr Vec2 operator-() const { return Vec2(-x, -y); }
+
+  constexpr Vec2& operator+=(const Vec2& rhs) { return *this = *this + rhs; }
+  constexpr Vec2& operator-=(const Vec2& rhs) { return *this = *this - rhs; }
+  constexpr Vec2& operator*=(T rhs) { return *this = *this * rhs; }
+
+  constexpr bool operator==(const Vec2& rhs) const {
+    return x == rhs.x && y == rhs.y;
+  }
+  constexpr bool operator!=(const Vec2& rhs) const { return !(*this == rhs); }
+};
+
+template <typename T>
+struct Vec3 {
+  T x, y, z;
+
+  constexpr Vec3(T x = T(), T y = T(), T z = T()) : x(x), y(y), z(z) {}
+
+  constexpr Vec3 operator+(const Vec3& rhs) const {
+    return Vec3(x + rhs.x, y + rhs.y, z + rhs.z);
+  }
+  constexpr Vec3 operator-(const Vec3& rhs) const {
+    return Vec3(x - rhs.x, y - rhs.y, z - rhs.z);
+  }
+  constexpr Vec3 operator*(const Vec3& rhs) const {
+    return Vec3(x * rhs.x, y * rhs.y, z * rhs.z);
+  }
+  constexpr Vec3 operator*(T rhs) const {
+    return Vec3(x * rhs, y * rhs, z * rhs);
+  }
+  constexpr Vec3 operator/(T rhs) const {
+    return Vec3(x / rhs, y / rhs, z / rhs);
+  }
+  constexpr Vec3 operator-() const { return Vec3(-x, -y, -z); }
+
+  constexpr Vec3& operator+=(const Vec3& rhs) { return *this = *this + rhs; }
+  constexpr Vec3& operator-=(const Vec3& rhs) { return *this = *this - rhs; }
+  constexpr Vec3& operator*=(T rhs) { return *this = *this * rhs; }
+
+  constexpr bool operator==(const Vec3& rhs) const {
+    return x == rhs.x && y == rhs.y && z == rhs.z;
+  }
+  constexpr bool operator!=(const Vec3& rhs) const { return !(*this == rhs); }
+};
+
+// Register-wide operations on a whole Vec4, specialized below once Vec4 is
+// complete. `enabled` is false when the target has no suitable instructions.
+template <typename T>
+struct Vec4Simd {
+  static const bool enabled = false;
+};
+
+// Aligned to its full size so it can be loaded as one register
+template <typename T>
+struct alignas(4 * sizeof(T)) Vec4 {
+  T x, y, z, w;
+
+  constexpr Vec4(T x = T(), T y = T(), T z = T(), T w = T())
+      : x(x), y(y), z(z), w(w) {}
+
+  constexpr Vec4 operator+(const Vec4& rhs) const {
+    if constexpr (Vec4Simd<T>::enabled) {
+      if (!VEC_MATH_CONSTANT_EVALUATED()) {
+        return Vec4Simd<T>::add(*this, rhs);
+      }
+    }
+    return Vec4(x + rhs.x, y + rhs.y, z + rhs.z, w + rhs.w);
+  }
+  constexpr Vec4 operator-(const Vec4& rhs) const {
+    if constexpr (Vec4Simd<T>::enabled) {
+      if (!VEC_MATH_CONSTANT_EVALUATED()) {
+        return Vec4Simd<T>::sub(*this, rhs);
+      }
+    }
+    return Vec4(x - rhs.x, y - rhs.y, z - rhs.z, w - rhs.w);
+  }
+  constexpr Vec4 operator*(const Vec4& rhs) const {
+    if constexpr (Vec4Simd<T>::enabled) {
+      if (!VEC_MATH_CONSTANT_EVALUATED()) {
+        return Vec4Simd<T>::mul(*this, rhs);
+      }
+    }
+    return Vec4(x * rhs.x, y * rhs.y, z * rhs.z, w * rhs.w);
+  }
+  constexpr Vec4 operator*(T rhs) const {
+    if constexpr (Vec4Simd<T>::enabled) {
+      if (!VEC_MATH_CONSTANT_EVALUATED()) {
+        return Vec4Simd<T>::scale(*this, rhs);
+      }
+    }
+    return Vec4(x * rhs, y * rhs, z * rhs, w * rhs);
+  }
+  constexpr Vec4 operator/(T rhs) const { return *this * (T(1) / rhs); }
+  constexpr Vec4 operator-() const { return Vec4(-x, -y, -z, -w); }
+
+  constexpr Vec4& operator+=(const Vec4& rhs) { return *this = *this + rhs; }
+  constexpr Vec4& operator-=(const Vec4& rhs) { return *this = *this - rhs; }
+  constexpr Vec4& operator*=(T rhs) { return *this = *this * rhs; }
+
+  constexpr bool operator==(const Vec4& rhs) const {
+    return x == rhs.x && y == rhs.y && z == rhs.z && w == rhs.w;
+  }
+  constexpr bool operator!=(const Vec4& rhs) const { return !(*this == rhs); }
+};
+
+#if defined(__SSE2__)
+template <>
+struct Vec4Simd<float> {
+  static const bool enabled = true;
+
+  static __m128 load(const Vec4<float>& v) { return _mm_load_ps(&v.x); }
+  static Vec4<float> store(__m128 r) {
+    Vec4<float> v;
+    _mm_store_ps(&v.x, r);
+    return v;
+  }
+  static Vec4<float> add(const Vec4<float>& a, const Vec4<float>& b) {
+    return store(_mm_add_ps(load(a), load(b)));
+  }
+  static Vec4<float> sub(const Vec4<float>& a, const Vec4<float>& b) {
+    return store(_mm_sub_ps(load(a), load(b)));
+  }
+  static Vec4<float> mul(const Vec4<float>& a, const Vec4<float>& b) {
+    return store(_mm_mul_ps(load(a), load(b)));
+  }
+  static Vec4<float> scale(const Vec4<float>& a, float s) {
+    return store(_mm_mul_ps(load(a), _mm_set1_ps(s)));
+  }
+  static float dot(const Vec4<float>& a, const Vec4<float>& b) {
+    __m128 m = _mm_mul_ps(load(a), load(b));
+    __m128 swapped = _mm_shuffle_ps(m, m, _MM_SHUFFLE(2, 3, 0, 1));
+    __m128 sums = _mm_add_ps(m, swapped);
+    swapped = _mm_movehl_ps(swapped, sums);
+    return _mm_cvtss_f32(_mm_add_ss(sums, swapped));
+  }
+};
+#endif
+
+#if defined(__AVX__)
+template <>
+struct Vec4Simd<double> {
+  static const bool enabled = true;
+
+  static __m256d load(const Vec4<double>& v) { return _mm256_load_pd(&v.x); }
+  static Vec4<double> store(__m256d r) {
+    Vec4<double> v;
+    _mm256_store_pd(&v.x, r);
+    return v;
+  }
+  static Vec4<double> add(const Vec4<double>& a, const Vec4<double>& b) {
+    return store(_mm256_add_pd(load(a), load(b)));
+  }
+  static Vec4<double> sub(const Vec4<double>& a, const Vec4<double>& b) {
+    return store(_mm256_sub_pd(load(a), load(b)));
+  }
+  static Vec4<double> mul(const Vec4<double>& a, const Vec4<double>& b) {
+    return store(_mm256_mul_pd(load(a), load(b)));
+  }
+  static Vec4<double> scale(const Vec4<double>& a, double s) {
+    return store(_mm256_mul_pd(load(a), _mm256_set1_pd(s)));
+  }
+  static double dot(const Vec4<double>& a, const Vec4<double>& b) {
+    __m256d m = _mm256_mul_pd(load(a), load(b));
+    __m128d pairs = _mm_add_pd(_mm256_castpd256_pd128(m),
+                               _mm256_extractf128_pd(m, 1));
+    return _mm_cvtsd_f64(_mm_add_sd(pairs, _mm_unpackhi_pd(pairs, pairs)));
+  }
+};
+#endif
+
+typedef Vec2<float> Vec2f;
+typedef Vec2<double> Vec2d;
+typedef Vec3<float> Vec3f;
+typedef Vec3<double> Vec3d;
+typedef Vec4<float> Vec4f;
+typedef Vec4<double> Vec4d;
+
+template <typename T>
+constexpr T dot(const Vec2<T>& a, const Vec2<T>& b) {
+  return a.x * b.x + a.y * b.y;
+}
+
+template <typename T>
+constexpr T dot(const Vec3<T>& a, const Vec3<T>& b) {
+  return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+template <typename T>
+constexpr T dot(const Vec4<T>& a, const Vec4<T>& b) {
+  if constexpr (Vec4Simd<T>::enabled) {
+    if (!VEC_MATH_CONSTANT_EVALUATED()) {
+      return Vec4Simd<T>::dot(a, b);
+    }
+  }
+  return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+}
+
+// z component of the 3D cross product, i.e. the signed parallelogram area
+template <typename T>
+constexpr T cross(const Vec2<T>& a, const Vec2<T>& b) {
+  return a.x * b.y - a.y * b.x;
+}
+
+template <typename T>
+constexpr Vec3<T> cross(const Vec3<T>& a, const Vec3<T>& b) {
+  return Vec3<T>(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z,
+                 a.x * b.y - a.y * b.x);
+}
+
+template <typename V>
+constexpr auto lengthSquared(const V& v) -> decltype(dot(v, v)) {
+  return dot(v, v);
+}
+
+template <typename V>
+inline auto length(const V& v) -> decltype(dot(v, v)) {
+  return std::sqrt(dot(v, v));
+}
+
+// Zero vectors stay zero instead of turning into NaNs
+template <typename V>
+inline V normalize(const V& v) {
+  auto squared = dot(v, v);
+  if (squared == 0) {
+    return v;
+  }
+  return v * (1 / std::sqrt(squared));
+}
+
+// Row-major 3x3 matrix for batch transforms
+template <typename T>
+struct Mat3 {
+  T m[3][3];
+
+  constexpr Vec3<T> operator*(const Vec3<T>& v) const {
+    return Vec3<T>(m[0][0] * v.x + m[0][1] * v.y + m[0][2] * v.z,
+                   m[1][0] * v.x + m[1][1] * v.y + m[1][2] * v.z,
+                   m[2][0] * v.x + m[2][1] * v.y + m[2][2] * v.z);
+  }
+};
+
+// Structure-of-arrays batches: one contiguous array per component, which
+// is what the kernels below stream through
+template <typename T>
+struct Vec2Array {
+  std::vector<T> x, y;
+
+  explicit Vec2Array(size_t count = 0) : x(count), y(count) {}
+
+  size_t size() const { return x.size(); }
+  Vec2<T> get(size_t i) const { return Vec2<T>(x[i], y[i]); }
+  void set(size_t i, const Vec2<T>& v) {
+    x[i] = v.x;
+    y[i] = v.y;
+  }
+};
+
+template <typename T>
+struct Vec3Array {
+  std::vector<T> x, y, z;
+
+  explicit Vec3Array(size_t count = 0) : x(count), y(count), z(count) {}
+
+  size_t size() const { return x.size(); }
+  Vec3<T> get(size_t i) const { return Vec3<T>(x[i], y[i], z[i]); }
+  void set(size_t i, const Vec3<T>& v) {
+    x[i] = v.x;
+    y[i] = v.y;
+    z[i] = v.z;
+  }
+};
+
+// Widest register of T available on the target, with a scalar fallback
+template <typename T>
+struct SimdPack {
+  static const size_t width = 1;
+  T v;
+
+  static SimdPack load(const T* p) { return {*p}; }
+  static SimdPack broadcast(T s) { return {s}; }
+  void store(T* p) const { *p = v; }
+  SimdPack operator+(SimdPack o) const { return {v + o.v}; }
+  SimdPack operator-(SimdPack o) const { return {v - o.v}; }
+  SimdPack operator*(SimdPack o) const { return {v * o.v}; }
+  SimdPack operator/(SimdPack o) const { return {v / o.v}; }
+  SimdPack sqrt() const { return {std::sqrt(v)}; }
+};
+
+#if defined(__AVX__)
+template <>
+struct SimdPack<float> {
+  static const size_t width = 8;
+  __m256 v;
+
+  static SimdPack load(const float* p) { return {_mm256_loadu_ps(p)}; }
+  static SimdPack broadcast(float s) { return {_mm256_set1_ps(s)}; }
+  void store(float* p) const { _mm256_storeu_ps(p, v); }
+  SimdPack operator+(SimdPack o) const { return {_mm256_add_ps(v, o.v)}; }
+  SimdPack operator-(SimdPack o) const { return {_mm256_sub_ps(v, o.v)}; }
+  SimdPack operator*(SimdPack o) const { return {_mm256_mul_ps(v, o.v)}; }
+  SimdPack operator/(SimdPack o) const { return {_mm256_div_ps(v, o.v)}; }
+  SimdPack sqrt() const { return {_mm256_sqrt_ps(v)}; }
+};
+
+template <>
+struct SimdPack<double> {
+  static const size_t width = 4;
+  __m256d v;
+
+  static SimdPack load(const double* p) { return {_mm256_loadu_pd(p)}; }
+  static SimdPack broadcast(double s) { return {_mm256_set1_pd(s)}; }
+  void store(double* p) const { _mm256_storeu_pd(p, v); }
+  SimdPack operator+(SimdPack o) const { return {_mm256_add_pd(v, o.v)}; }
+  SimdPack operator-(SimdPack o) const { return {_mm256_sub_pd(v, o.v)}; }
+  SimdPack operator*(SimdPack o) const { return {_mm256_mul_pd(v, o.v)}; }
+  SimdPack operator/(SimdPack o) const { return {_mm256_div_pd(v, o.v)}; }
+  SimdPack sqrt() const { return {_mm256_sqrt_pd(v)}; }
+};
+#elif defined(__SSE2__)
+template <>
+struct SimdPack<float> {
+  static const size_t width = 4;
+  __m128 v;
+
+  static SimdPack load(const float* p) { return {_mm_loadu_ps(p)}; }
+  static SimdPack broadcast(float s) { return {_mm_set1_ps(s)}; }
+  void store(float* p) const { _mm_storeu_ps(p, v); }
+  SimdPack operator+(SimdPack o) const { return {_mm_add_ps(v, o.v)}; }
+  SimdPack operator-(SimdPack o) const { return {_mm_sub_ps(v, o.v)}; }
+  SimdPack operator*(SimdPack o) const { return {_mm_mul_ps(v, o.v)}; }
+  SimdPack operator/(SimdPack o) const { return {_mm_div_ps(v, o.v)}; }
+  SimdPack sqrt() const { return {_mm_sqrt_ps(v)}; }
+};
+
+template <>
+struct SimdPack<double> {
+  static const size_t width = 2;
+  __m128d v;
+
+  static SimdPack load(const double* p) { return {_mm_loadu_pd(p)}; }
+  static SimdPack broadcast(double s) { return {_mm_set1_pd(s)}; }
+  void store(double* p) const { _mm_storeu_pd(p, v); }
+  SimdPack operator+(SimdPack o) const { return {_mm_add_pd(v, o.v)}; }
+  SimdPack operator-(SimdPack o) const { return {_mm_sub_pd(v, o.v)}; }
+  SimdPack operator*(SimdPack o) const { return {_mm_mul_pd(v, o.v)}; }
+  SimdPack operator/(SimdPack o) const { return {_mm_div_pd(v, o.v)}; }
+  SimdPack sqrt() const { return {_mm_sqrt_pd(v)}; }
+};
+#endif
+
+// out = a * s + b, one component array at a time
+template <typename T>
+inline void batchMulAdd(const T* a, T s, const T* b, T* out, size_t count) {
+  typedef SimdPack<T> Wide;
+  Wide scale = Wide::broadcast(s);
+  size_t i = 0;
+  for (; i + Wide::width <= count; i += Wide::width) {
+    (Wide::load(a + i) * scale + Wide::load(b + i)).store(out + i);
+  }
+  for (; i < count; i++) {
+    out[i] = a[i] * s + b[i];
+  }
+}
+
+template <typename T>
+inline void batchAdd(const T* a, const T* b, T* out, size_t count) {
+  typedef SimdPack<T> Wide;
+  size_t i = 0;
+  for (; i + Wide::width <= count; i += Wide::width) {
+    (Wide::load(a + i) + Wide::load(b + i)).store(out + i);
+  }
+  for (; i < count; i++) {
+    out[i] = a[i] + b[i];
+  }
+}
+
+template <typename T>
+inline void batchScale(const T* a, T s, T* out, size_t count) {
+  typedef SimdPack<T> Wide;
+  Wide scale = Wide::broadcast(s);
+  size_t i = 0;
+  for (; i + Wide::width <= count; i += Wide::width) {
+    (Wide::load(a + i) * scale).store(out + i);
+  }
+  for (; i < count; i++) {
+    out[i] = a[i] * s;
+  }
+}
+
+template <typename T>
+inline void batchAdd(const Vec2Array<T>& a, const Vec2Array<T>& b,
+                     Vec2Array<T>& out) {
+  batchAdd(a.x.data(), b.x.data(), out.x.data(), a.size());
+  batchAdd(a.y.data(), b.y.data(), out.y.data(), a.size());
+}
+
+template <typename T>
+inline void batchAdd(const Vec3Array<T>& a, const Vec3Array<T>& b,
+                     Vec3Array<T>& out) {
+  batchAdd(a.x.data(), b.x.data(), out.x.data(), a.size());
+  batchAdd(a.y.data(), b.y.data(), out.y.data(), a.size());
+  batchAdd(a.z.data(), b.z.data(), out.z.data(), a.size());
+}
+
+// positions += velocities * dt, the usual integration step
+template <typename T>
+inline void batchIntegrate(Vec2Array<T>& positions,
+                           const Vec2Array<T>& velocities, T dt) {
+  size_t n = positions.size();
+  batchMulAdd(velocities.x.data(), dt, positions.x.data(), positions.x.data(),
+              n);
+  batchMulAdd(velocities.y.data(), dt, positions.y.data(), positions.y.data(),
+              n);
+}
+
+template <typename T>
+inline void batchIntegrate(Vec3Array<T>& positions,
+                           const Vec3Array<T>& velocities, T dt) {
+  size_t n = positions.size();
+  batchMulAdd(velocities.x.data(), dt, positions.x.data(), positions.x.data(),
+              n);
+  batchMulAdd(velocities.y.data(), dt, positions.y.data(), positions.y.data(),
+              n);
+  batchMulAdd(velocities.z.data(), dt, positions.z.data(), positions.z.data(),
+              n);
+}
+
+template <typename T>
+inline void batchDot(const Vec3Array<T>& a, const Vec3Array<T>& b, T* out) {
+  typedef SimdPack<T> Wide;
+  size_t n = a.size(), i = 0;
+  for (; i + Wide::width <= n; i += Wide::width) {
+    (Wide::load(&a.x[i]) * Wide::load(&b.x[i]) +
+     Wide::load(&a.y[i]) * Wide::load(&b.y[i]) +
+     Wide::load(&a.z[i]) * Wide::load(&b.z[i]))
+        .store(out + i);
+  }
+  for (; i < n; i++) {
+    out[i] = a.x[i] * b.x[i] + a.y[i] * b.y[i] + a.z[i] * b.z[i];
+  }
+}
+
+template <typename T>
+inline void batchCross(const Vec3Array<T>& a, const Vec3Array<T>& b,
+                       Vec3Array<T>& out) {
+  typedef SimdPack<T> Wide;
+  size_t n = a.size(), i = 0;
+  for (; i + Wide::width <= n; i += Wide::width) {
+    Wide ax = Wide::load(&a.x[i]), ay = Wide::load(&a.y[i]),
+         az = Wide::load(&a.z[i]);
+    Wide bx = Wide::load(&b.x[i]), by = Wide::load(&b.y[i]),
+         bz = Wide::load(&b.z[i]);
+    (ay * bz - az * by).store(&out.x[i]);
+    (az * bx - ax * bz).store(&out.y[i]);
+    (ax * by - ay * bx).store(&out.z[i]);
+  }
+  for (; i < n; i++) {
+    out.set(i, cross(a.get(i), b.get(i)));
+  }
+}
+
+template <typename T>
+inline void batchLength(const Vec3Array<T>& a, T* out) {
+  typedef SimdPack<T> Wide;
+  size_t n = a.size(), i = 0;
+  for (; i + Wide::width <= n; i += Wide::width) {
+    Wide x = Wide::load(&a.x[i]), y = Wide::load(&a.y[i]),
+         z = Wide::load(&a.z[i]);
+    (x * x + y * y + z * z).sqrt().store(out + i);
+  }
+  for (; i < n; i++) {
+    out[i] = length(a.get(i));
+  }
+}
+
+// In place. Zero vectors are left as they are, matching normalize().
+template <typename T>
+inline void batchNormalize(Vec3Array<T>& a) {
+  typedef SimdPack<T> Wide;
+  size_t n = a.size(), i = 0;
+  for (; i + Wide::width <= n; i += Wide::width) {
+    Wide x = Wide::load(&a.x[i]), y = Wide::load(&a.y[i]),
+         z = Wide::load(&a.z[i]);
+    Wide len = (x * x + y * y + z * z).sqrt();
+    T lanes[Wide::width];
+    len.store(lanes);
+    bool anyZero = false;
+    for (size_t k = 0; k < Wide::width; k++) {
+      anyZero |= lanes[k] == 0;
+    }
+    if (anyZero) {
+      for (size_t k = i; k < i + Wide::width; k++) {
+        a.set(k, normalize(a.get(k)));
+      }
+      continue;
+    }
+    (x / len).store(&a.x[i]);
+    (y / len).store(&a.y[i]);
+    (z / len).store(&a.z[i]);
+  }
+  for (; i < n; i++) {
+    a.set(i, normalize(a.get(i)));
+  }
+}
+
+// out = m * in + translation for every vector
+template <typename T>
+inline void batchTransform(const Mat3<T>& m, const Vec3<T>& translation,
+                           const Vec3Array<T>& in, Vec3Array<T>& out) {
+  typedef SimdPack<T> Wide;
+  size_t n = in.size(), i = 0;
+  Wide m00 = Wide::broadcast(m.m[0][0]), m01 = Wide::broadcast(m.m[0][1]),
+       m02 = Wide::broadcast(m.m[0][2]), m10 = Wide::broadcast(m.m[1][0]),
+       m11 = Wide::broadcast(m.m[1][1]), m12 = Wide::broadcast(m.m[1][2]),
+       m20 = Wide::broadcast(m.m[2][0]), m21 = Wide::broadcast(m.m[2][1]),
+       m22 = Wide::broadcast(m.m[2][2]);
+  Wide tx = Wide::broadcast(translation.x), ty = Wide::broadcast(translation.y),
+       tz = Wide::broadcast(translation.z);
+  for (; i + Wide::width <= n; i += Wide::width) {
+    Wide x = Wide::load(&in.x[i]), y = Wide::load(&in.y[i]),
+         z = Wide::load(&in.z[i]);
+    (m00 * x + m01 * y + m02 * z + tx).store(&out.x[i]);
+    (m10 * x + m11 * y + m12 * z + ty).store(&out.y[i]);
+    (m20 * x + m21 * y + m22 * z + tz).store(&out.z[i]);
+  }
+  for (; i < n; i++) {
+    out.set(i, m * in.get(i) + translation);
+  }
+}
+
+#endif  // VEC_MATH_H
@@ -2,18 +2,18 @@
 
 Vector::Vector(double x, double y) : x(x), y(y) {}
 
-Vector Vector::operator*(double rhs) {
+Vector Vector::operator*(double rhs) const {
   return Vector(this->x * rhs, this->y * rhs);
 }
 
-Vector Vector::operator+(const Vector& rhs) {
+Vector Vector::operator+(const Vector& rhs) const {
   return Vector(this->x + rhs.x, this->y + rhs.y);
 }
 
-Vector Vector::operator-(const Vector& rhs) {
+Vector Vector::operator-(const Vector& rhs) const {
   return Vector(this->x - rhs.x, this->y - rhs.y);
 }
 
-Vector Vector::operator*(const Vector& rhs) {
+Vector Vector::operator*(const Vector& rhs) const {
   return Vector(this->x * rhs.x, this->y * rhs.y);
 }
\ No newline at end of file
@@ -8,13 +8,13 @@ class Vector {
   Vector(double x = 0.0, double y = 0.0);
 
   // Overload + for vector addition
-  Vector operator+(const Vector& rhs);
+  Vector operator+(const Vector& rhs) const;
 
   // Overload - for vector subtraction
-  Vector operator-(const Vector& rhs);
+  Vector operator-(const Vector& rhs) const;
 
-  Vector operator*(const Vector& rhs);
+  Vector operator*(const Vector& rhs) const;
   // Overload * for scalar multiplication
-  Vector operator*(double rhs);
+  Vector operator*(double rhs) const;
 };
 #endif  // VECTOR_H
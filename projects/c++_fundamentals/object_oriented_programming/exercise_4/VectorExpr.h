@@ -0,0 +1,197 @@
+#ifndef VECTOR_EXPR_H
+#define VECTOR_EXPR_H
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "Vector.h"
+
+// Expression templates over whole arrays of 2D vectors.
+//
+// `a + b * s - c` on VectorArrays does not compute anything; it builds a
+// small expression object that knows how to produce element i. Assigning
+// that expression to a VectorArray runs one loop over the elements, with no
+// intermediate arrays and no Vector temporaries.
+
+template <typename E>
+class VectorExpr {
+ public:
+  const E& self() const { return static_cast<const E&>(*this); }
+
+  double x(size_t i) const { return self().x(i); }
+  double y(size_t i) const { return self().y(i); }
+  size_t size() const { return self().size(); }
+
+  Vector operator[](size_t i) const { return Vector(x(i), y(i)); }
+};
+
+// Array storage, one component per array so the fused loop vectorizes
+class VectorArray : public VectorExpr<VectorArray> {
+ private:
+  std::vector<double> xs, ys;
+
+ public:
+  explicit VectorArray(size_t count = 0) : xs(count), ys(count) {}
+
+  template <typename E>
+  VectorArray(const VectorExpr<E>& expr) : xs(expr.size()), ys(expr.size()) {
+    assign(expr);
+  }
+
+  template <typename E>
+  VectorArray& operator=(const VectorExpr<E>& expr) {
+    if (expr.size() != size()) {
+      xs.resize(expr.size());
+      ys.resize(expr.size());
+    }
+    return assign(expr);
+  }
+
+  template <typename E>
+  VectorArray& operator+=(const VectorExpr<E>& expr) {
+    checkSize(expr.size());
+    for (size_t i = 0; i < xs.size(); i++) {
+      xs[i] += expr.x(i);
+      ys[i] += expr.y(i);
+    }
+    return *this;
+  }
+
+  template <typename E>
+  VectorArray& operator-=(const VectorExpr<E>& expr) {
+    checkSize(expr.size());
+    for (size_t i = 0; i < xs.size(); i++) {
+      xs[i] -= expr.x(i);
+      ys[i] -= expr.y(i);
+    }
+    return *this;
+  }
+
+  double x(size_t i) const { return xs[i]; }
+  double y(size_t i) const { return ys[i]; }
+  size_t size() const { return xs.size(); }
+
+  void set(size_t i, const Vector& v) {
+    xs[i] = v.x;
+    ys[i] = v.y;
+  }
+
+ private:
+  void checkSize(size_t other) const {
+    if (other != size()) {
+      throw std::invalid_argument("VectorArray sizes differ");
+    }
+  }
+
+  // Elements are only ever combined at the same index, so `a = a + b` is
+  // safe without a temporary
+  template <typename E>
+  VectorArray& assign(const VectorExpr<E>& expr) {
+    const E& e = expr.self();
+    double* outX = xs.data();
+    double* outY = ys.data();
+    const size_t count = xs.size();
+    for (size_t i = 0; i < count; i++) {
+      outX[i] = e.x(i);
+      outY[i] = e.y(i);
+    }
+    return *this;
+  }
+};
+
+// Arrays are held by reference, sub-expressions by value: expressions are
+// meant to be consumed in the statement that builds them
+template <typename E>
+struct ExprOperand {
+  typedef const E type;
+};
+
+template <>
+struct ExprOperand<VectorArray> {
+  typedef const VectorArray& type;
+};
+
+struct AddOp {
+  static double apply(double a, double b) { return a + b; }
+};
+struct SubOp {
+  static double apply(double a, double b) { return a - b; }
+};
+struct MulOp {
+  static double apply(double a, double b) { return a * b; }
+};
+
+template <typename L, typename R, typename Op>
+class BinaryExpr : public VectorExpr<BinaryExpr<L, R, Op>> {
+ private:
+  typename ExprOperand<L>::type lhs;
+  typename ExprOperand<R>::type rhs;
+
+ public:
+  BinaryExpr(const L& lhs, const R& rhs) : lhs(lhs), rhs(rhs) {
+    if (lhs.size() != rhs.size()) {
+      throw std::invalid_argument("VectorArray sizes differ");
+    }
+  }
+
+  double x(size_t i) const { return Op::apply(lhs.x(i), rhs.x(i)); }
+  double y(size_t i) const { return Op::apply(lhs.y(i), rhs.y(i)); }
+  size_t size() const { return lhs.size(); }
+};
+
+template <typename E>
+class ScaledExpr : public VectorExpr<ScaledExpr<E>> {
+ private:
+  typename ExprOperand<E>::type expr;
+  double scale;
+
+ public:
+  ScaledExpr(const E& expr, double scale) : expr(expr), scale(scale) {}
+
+  double x(size_t i) const { return expr.x(i) * scale; }
+  double y(size_t i) const { return expr.y(i) * scale; }
+  size_t size() const { return expr.size(); }
+};
+
+template <typename L, typename R>
+BinaryExpr<L, R, AddOp> operator+(const VectorExpr<L>& lhs,
+                                  const VectorExpr<R>& rhs) {
+  return BinaryExpr<L, R, AddOp>(lhs.self(), rhs.self());
+}
+
+template <typename L, typename R>
+BinaryExpr<L, R, SubOp> operator-(const VectorExpr<L>& lhs,
+                                  const VectorExpr<R>& rhs) {
+  return BinaryExpr<L, R, SubOp>(lhs.self(), rhs.self());
+}
+
+// Component-wise, like Vector::operator*(const Vector&)
+template <typename L, typename R>
+BinaryExpr<L, R, MulOp> operator*(const VectorExpr<L>& lhs,
+                                  const VectorExpr<R>& rhs) {
+  return BinaryExpr<L, R, MulOp>(lhs.self(), rhs.self());
+}
+
+template <typename E>
+ScaledExpr<E> operator*(const VectorExpr<E>& expr, double scale) {
+  return ScaledExpr<E>(expr.self(), scale);
+}
+
+template <typename E>
+ScaledExpr<E> operator*(double scale, const VectorExpr<E>& expr) {
+  return ScaledExpr<E>(expr.self(), scale);
+}
+
+template <typename E>
+ScaledExpr<E> operator/(const VectorExpr<E>& expr, double scale) {
+  return ScaledExpr<E>(expr.self(), 1.0 / scale);
+}
+
+template <typename E>
+ScaledExpr<E> operator-(const VectorExpr<E>& expr) {
+  return ScaledExpr<E>(expr.self(), -1.0);
+}
+
+#endif  // VECTOR_EXPR_H
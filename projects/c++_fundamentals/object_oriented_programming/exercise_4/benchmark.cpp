@@ -0,0 +1,97 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "VecMath.h"
+#include "Vector.h"
+
+using std::cout;
+using std::endl;
+
+const size_t kCount = 1000000;
+const int kSteps = 50;
+const double kDt = 1.0 / 60.0;
+// Element whose value is printed so the loops cannot be optimized away
+const size_t kProbe = 12345;
+
+template <typename Function>
+double nanosecondsPerVector(Function step) {
+  auto begin = std::chrono::steady_clock::now();
+  for (int s = 0; s < kSteps; s++) {
+    step();
+  }
+  return std::chrono::duration<double, std::nano>(
+             std::chrono::steady_clock::now() - begin)
+             .count() /
+         (static_cast<double>(kCount) * kSteps);
+}
+
+void printRow(const std::string& name, double ns, double baseline,
+              double checksum) {
+  cout << std::setw(28) << name << std::setw(12) << ns << std::setw(10)
+       << baseline / ns << std::setw(18) << checksum << endl;
+}
+
+// One integration step, position = position + velocity * dt, over a million
+// 2D vectors with each representation
+int main() {
+  cout << "position += velocity * dt over " << kCount << " vectors, "
+       << kSteps << " steps" << endl;
+  cout << std::fixed << std::setprecision(3);
+  cout << std::setw(28) << "representation" << std::setw(12) << "ns/vector"
+       << std::setw(10) << "speedup" << std::setw(18) << "checksum" << endl;
+
+  std::vector<Vector> positions(kCount), velocities(kCount);
+  std::vector<Vec2d> positions2(kCount), velocities2(kCount);
+  Vec2Array<double> positionsSoA(kCount), velocitiesSoA(kCount);
+  for (size_t i = 0; i < kCount; i++) {
+    velocities[i] = Vector(i % 7, i % 11);
+    velocities2[i] = Vec2d(i % 7, i % 11);
+    velocitiesSoA.set(i, Vec2d(i % 7, i % 11));
+  }
+
+  double vectorNs = nanosecondsPerVector([&]() {
+    for (size_t i = 0; i < kCount; i++) {
+      positions[i] = positions[i] + velocities[i] * kDt;
+    }
+  });
+  printRow("Vector (out-of-line)", vectorNs, vectorNs,
+           positions[kProbe].x + positions[kProbe].y);
+
+  double inlineNs = nanosecondsPerVector([&]() {
+    for (size_t i = 0; i < kCount; i++) {
+      positions2[i] += velocities2[i] * kDt;
+    }
+  });
+  printRow("Vec2d (inline)", inlineNs, vectorNs,
+           positions2[kProbe].x + positions2[kProbe].y);
+
+  double batchNs = nanosecondsPerVector(
+      [&]() { batchIntegrate(positionsSoA, velocitiesSoA, kDt); });
+  Vec2d last = positionsSoA.get(kProbe);
+  printRow("Vec2Array (SoA batch)", batchNs, vectorNs, last.x + last.y);
+
+  // Float 3D kernels Vector has no counterpart for
+  std::vector<Vec3f> directions(kCount);
+  Vec3Array<float> directionsSoA(kCount);
+  for (size_t i = 0; i < kCount; i++) {
+    Vec3f v(1.0f + i % 5, 2.0f + i % 3, 0.5f);
+    directions[i] = v;
+    directionsSoA.set(i, v);
+  }
+
+  cout << endl << "normalize over " << kCount << " Vec3f" << endl;
+  double aosNs = nanosecondsPerVector([&]() {
+    for (Vec3f& direction : directions) {
+      direction = normalize(direction);
+    }
+  });
+  printRow("std::vector<Vec3f>", aosNs, aosNs, directions[7].x);
+  double soaNs =
+      nanosecondsPerVector([&]() { batchNormalize(directionsSoA); });
+  printRow("Vec3Array<float>", soaNs, aosNs, directionsSoA.get(7).x);
+
+  return 0;
+}
@@ -0,0 +1,100 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "Vector.h"
+#include "VectorExpr.h"
+
+using std::cout;
+using std::endl;
+
+const double kScale = 0.5;
+
+// Whole-array operators the eager way: every operator returns a new array
+std::vector<Vector> operator+(const std::vector<Vector>& a,
+                              const std::vector<Vector>& b) {
+  std::vector<Vector> out(a.size());
+  for (size_t i = 0; i < a.size(); i++) {
+    out[i] = a[i] + b[i];
+  }
+  return out;
+}
+
+std::vector<Vector> operator-(const std::vector<Vector>& a,
+                              const std::vector<Vector>& b) {
+  std::vector<Vector> out(a.size());
+  for (size_t i = 0; i < a.size(); i++) {
+    out[i] = a[i] - b[i];
+  }
+  return out;
+}
+
+std::vector<Vector> operator*(const std::vector<Vector>& a, double s) {
+  std::vector<Vector> out(a.size());
+  for (size_t i = 0; i < a.size(); i++) {
+    out[i] = a[i] * s;
+  }
+  return out;
+}
+
+template <typename Function>
+double nanosecondsPerElement(size_t count, Function function) {
+  int repeats = static_cast<int>(20000000 / count) + 1;
+  auto begin = std::chrono::steady_clock::now();
+  for (int r = 0; r < repeats; r++) {
+    function();
+  }
+  return std::chrono::duration<double, std::nano>(
+             std::chrono::steady_clock::now() - begin)
+             .count() /
+         (static_cast<double>(count) * repeats);
+}
+
+// r = a + b * s - c over arrays of 10^3 to 10^7 vectors
+int main() {
+  cout << "r = a + b * s - c, nanoseconds per element" << endl;
+  cout << std::fixed << std::setprecision(3);
+  cout << std::setw(10) << "count" << std::setw(16) << "eager arrays"
+       << std::setw(16) << "eager loop" << std::setw(18) << "expr templates"
+       << endl;
+
+  double sink = 0;
+  for (size_t count = 1000; count <= 10000000; count *= 10) {
+    std::vector<Vector> a(count), b(count), c(count), r(count);
+    VectorArray ea(count), eb(count), ec(count), er(count);
+    for (size_t i = 0; i < count; i++) {
+      a[i] = Vector(i % 13, i % 17);
+      b[i] = Vector(i % 7, i % 5);
+      c[i] = Vector(1, 2);
+      ea.set(i, a[i]);
+      eb.set(i, b[i]);
+      ec.set(i, c[i]);
+    }
+
+    // Each operator allocates and fills a whole temporary array
+    double eagerArrays = nanosecondsPerElement(count, [&]() {
+      r = a + b * kScale - c;
+    });
+    sink += r[count / 2].x;
+
+    // One loop, but every operator still builds a Vector temporary
+    double eagerLoop = nanosecondsPerElement(count, [&]() {
+      for (size_t i = 0; i < count; i++) {
+        r[i] = a[i] + b[i] * kScale - c[i];
+      }
+    });
+    sink += r[count / 2].x;
+
+    double expression = nanosecondsPerElement(count, [&]() {
+      er = ea + eb * kScale - ec;
+    });
+    sink += er.x(count / 2);
+
+    cout << std::setw(10) << count << std::setw(16) << eagerArrays
+         << std::setw(16) << eagerLoop << std::setw(18) << expression << endl;
+  }
+
+  cout << "checksum " << sink << endl;
+  return 0;
+}
@@ -0,0 +1,67 @@
+#ifndef CONCURRENT_STACK_H
+#define CONCURRENT_STACK_H
+
+#include <atomic>
+#include <cstdint>
+#include <optional>
+
+// Lock-free LIFO (Treiber stack) that can be shared by worker threads.
+//
+// Both the stack and its internal free list keep a 16-bit ABA tag in the
+// unused high bits of the head pointer, bumped on every change. Popped nodes
+// go back to the free list instead of being deleted, so a thread holding a
+// stale head can still read its `next` safely; node memory is only released
+// by the destructor.
+template <typename T>
+class ConcurrentStack {
+ private:
+  struct Node {
+    std::atomic<Node*> next;
+    alignas(T) unsigned char storage[sizeof(T)];
+
+    T* value() { return reinterpret_cast<T*>(storage); }
+  };
+
+  static_assert(sizeof(void*) == 8, "tagged heads need 64-bit pointers");
+  static const int kPointerBits = 48;
+  static const uint64_t kPointerMask = (uint64_t(1) << kPointerBits) - 1;
+
+  std::atomic<uint64_t> head;
+  std::atomic<uint64_t> freeNodes;
+
+  static Node* pointerOf(uint64_t tagged) {
+    return reinterpret_cast<Node*>(tagged & kPointerMask);
+  }
+  static uint64_t nextTag(uint64_t tagged) {
+    return (tagged >> kPointerBits) + 1;
+  }
+  static uint64_t pack(Node* node, uint64_t tag) {
+    return (tag << kPointerBits) | reinterpret_cast<uint64_t>(node);
+  }
+
+  static void pushNode(std::atomic<uint64_t>& list, Node* node);
+  static Node* popNode(std::atomic<uint64_t>& list);
+  Node* acquireNode();
+
+ public:
+  ConcurrentStack();
+  ~ConcurrentStack();
+
+  ConcurrentStack(const ConcurrentStack&) = delete;
+  ConcurrentStack& operator=(const ConcurrentStack&) = delete;
+
+  void push(const T& element);
+  void push(T&& element);
+
+  template <typename... Args>
+  void emplace(Args&&... args);
+
+  // Empty optional when there was nothing to pop
+  std::optional<T> try_pop();
+
+  // Only a hint while other threads are pushing or popping
+  bool empty() const;
+};
+
+#include "ConcurrentStack.tpp"
+#endif  // CONCURRENT_STACK_H
@@ -0,0 +1,104 @@
+#include <cassert>
+#include <new>
+#include <utility>
+
+#include "ConcurrentStack.h"
+
+template <typename T>
+ConcurrentStack<T>::ConcurrentStack() : head(0), freeNodes(0) {}
+
+template <typename T>
+ConcurrentStack<T>::~ConcurrentStack() {
+  Node* node = pointerOf(head.load());
+  while (node != nullptr) {
+    Node* next = node->next.load();
+    node->value()->~T();
+    delete node;
+    node = next;
+  }
+  node = pointerOf(freeNodes.load());
+  while (node != nullptr) {
+    Node* next = node->next.load();
+    delete node;
+    node = next;
+  }
+}
+
+template <typename T>
+void ConcurrentStack<T>::pushNode(std::atomic<uint64_t>& list, Node* node) {
+  uint64_t current = list.load(std::memory_order_relaxed);
+  uint64_t replacement;
+  do {
+    node->next.store(pointerOf(current), std::memory_order_relaxed);
+    replacement = pack(node, nextTag(current));
+  } while (!list.compare_exchange_weak(current, replacement,
+                                       std::memory_order_release,
+                                       std::memory_order_relaxed));
+}
+
+template <typename T>
+typename ConcurrentStack<T>::Node* ConcurrentStack<T>::popNode(
+    std::atomic<uint64_t>& list) {
+  uint64_t current = list.load(std::memory_order_acquire);
+  while (Node* node = pointerOf(current)) {
+    // node may already be popped and reused by another thread; that only
+    // makes this read stale, and the tag makes the exchange below fail
+    Node* next = node->next.load(std::memory_order_relaxed);
+    if (list.compare_exchange_weak(current, pack(next, nextTag(current)),
+                                   std::memory_order_acquire,
+                                   std::memory_order_acquire)) {
+      return node;
+    }
+  }
+  return nullptr;
+}
+
+template <typename T>
+typename ConcurrentStack<T>::Node* ConcurrentStack<T>::acquireNode() {
+  Node* node = popNode(freeNodes);
+  if (node == nullptr) {
+    node = new Node();
+    assert((reinterpret_cast<uint64_t>(node) & ~kPointerMask) == 0);
+  }
+  return node;
+}
+
+template <typename T>
+void ConcurrentStack<T>::push(const T& element) {
+  emplace(element);
+}
+
+template <typename T>
+void ConcurrentStack<T>::push(T&& element) {
+  emplace(std::move(element));
+}
+
+template <typename T>
+template <typename... Args>
+void ConcurrentStack<T>::emplace(Args&&... args) {
+  Node* node = acquireNode();
+  try {
+    new (node->storage) T(std::forward<Args>(args)...);
+  } catch (...) {
+    pushNode(freeNodes, node);
+    throw;
+  }
+  pushNode(head, node);
+}
+
+template <typename T>
+std::optional<T> ConcurrentStack<T>::try_pop() {
+  Node* node = popNode(head);
+  if (node == nullptr) {
+    return std::nullopt;
+  }
+  std::optional<T> element(std::move(*node->value()));
+  node->value()->~T();
+  pushNode(freeNodes, node);
+  return element;
+}
+
+template <typename T>
+bool ConcurrentStack<T>::empty() const {
+  return pointerOf(head.load(std::memory_order_acquire)) == nullptr;
+}
@@ -1,16 +1,74 @@
 #ifndef STACK_H
 #define STACK_H
 
+#include <cstddef>
+#include <optional>
+#include <type_traits>
 #include <vector>
 
-template <typename T>
+// Stack<T, N> keeps its first N elements inside the object and only moves
+// to the heap when it overflows. pop, try_pop and top never throw; pop on an
+// empty stack is a precondition violation.
+template <typename T, std::size_t N = 0>
 class Stack {
+  static_assert(std::is_nothrow_move_constructible<T>::value,
+                "Stack<T, N> moves elements in noexcept code");
+
+ private:
+  alignas(T) unsigned char inlineStorage[N * sizeof(T)];
+  T* elements;
+  std::size_t count;
+  std::size_t capacity;
+
+  // Moves to a block twice the size, building the new element there first
+  // so that arguments referring to current elements are still intact
+  template <typename... Args>
+  T& growAndEmplace(Args&&... args);
+  T* inlineElements() noexcept {
+    return reinterpret_cast<T*>(inlineStorage);
+  }
+
+ public:
+  Stack() noexcept;
+  Stack(Stack&& other) noexcept;
+  ~Stack();
+
+  Stack(const Stack&) = delete;
+  Stack& operator=(const Stack&) = delete;
+  Stack& operator=(Stack&&) = delete;
+
+  // Only allocates, and so can only throw std::bad_alloc, past N elements
+  void push(const T& element);
+  void push(T&& element);
+
+  template <typename... Args>
+  T& emplace(Args&&... args);
+
+  T pop() noexcept;
+  std::optional<T> try_pop() noexcept;
+  T& top() noexcept;
+
+  bool empty() const noexcept { return count == 0; }
+  std::size_t size() const noexcept { return count; }
+  bool onHeap() const noexcept { return capacity > N; }
+};
+
+// Stack<T> grows a std::vector and throws std::out_of_range when popped
+// while empty
+template <typename T>
+class Stack<T, 0> {
  private:
   std::vector<T> stackElements;
 
  public:
-  void push(T element);
+  void push(const T& element);
+  void push(T&& element);
+
+  template <typename... Args>
+  T& emplace(Args&&... args);
+
   T pop();
+  std::optional<T> try_pop();
   bool empty();
 };
 
@@ -1,24 +1,151 @@
-#include "Stack.h"
+#include <cassert>
+#include <memory>
+#include <stdexcept>
+#include <utility>
 
-using std::cout;
-using std::endl;
+#include "Stack.h"
 
 template <typename T>
-void Stack<T>::push(T element) {
+void Stack<T, 0>::push(const T& element) {
   stackElements.push_back(element);
 }
 
 template <typename T>
-T Stack<T>::pop() {
+void Stack<T, 0>::push(T&& element) {
+  stackElements.push_back(std::move(element));
+}
+
+template <typename T>
+template <typename... Args>
+T& Stack<T, 0>::emplace(Args&&... args) {
+  stackElements.emplace_back(std::forward<Args>(args)...);
+  return stackElements.back();
+}
+
+template <typename T>
+T Stack<T, 0>::pop() {
   if (stackElements.empty()) {
     throw std::out_of_range("Stack is empty");
   }
-  T tmp = stackElements.back();
+  T tmp = std::move(stackElements.back());
   stackElements.pop_back();
   return tmp;
 }
 
 template <typename T>
-bool Stack<T>::empty() {
+std::optional<T> Stack<T, 0>::try_pop() {
+  if (stackElements.empty()) {
+    return std::nullopt;
+  }
+  std::optional<T> tmp(std::move(stackElements.back()));
+  stackElements.pop_back();
+  return tmp;
+}
+
+template <typename T>
+bool Stack<T, 0>::empty() {
   return stackElements.empty();
-}
\ No newline at end of file
+}
+
+template <typename T, std::size_t N>
+Stack<T, N>::Stack() noexcept
+    : elements(inlineElements()), count(0), capacity(N) {}
+
+template <typename T, std::size_t N>
+Stack<T, N>::Stack(Stack&& other) noexcept
+    : elements(inlineElements()), count(other.count), capacity(N) {
+  if (other.onHeap()) {
+    elements = other.elements;
+    capacity = other.capacity;
+  } else {
+    for (std::size_t i = 0; i < count; i++) {
+      new (elements + i) T(std::move(other.elements[i]));
+      other.elements[i].~T();
+    }
+  }
+  other.elements = other.inlineElements();
+  other.count = 0;
+  other.capacity = N;
+}
+
+template <typename T, std::size_t N>
+Stack<T, N>::~Stack() {
+  for (std::size_t i = 0; i < count; i++) {
+    elements[i].~T();
+  }
+  if (onHeap()) {
+    std::allocator<T>().deallocate(elements, capacity);
+  }
+}
+
+template <typename T, std::size_t N>
+template <typename... Args>
+T& Stack<T, N>::growAndEmplace(Args&&... args) {
+  std::size_t newCapacity = capacity > 0 ? capacity * 2 : 1;
+  T* block = std::allocator<T>().allocate(newCapacity);
+  T* slot;
+  try {
+    slot = new (block + count) T(std::forward<Args>(args)...);
+  } catch (...) {
+    std::allocator<T>().deallocate(block, newCapacity);
+    throw;
+  }
+  for (std::size_t i = 0; i < count; i++) {
+    new (block + i) T(std::move(elements[i]));
+    elements[i].~T();
+  }
+  if (onHeap()) {
+    std::allocator<T>().deallocate(elements, capacity);
+  }
+  elements = block;
+  capacity = newCapacity;
+  count++;
+  return *slot;
+}
+
+template <typename T, std::size_t N>
+void Stack<T, N>::push(const T& element) {
+  emplace(element);
+}
+
+template <typename T, std::size_t N>
+void Stack<T, N>::push(T&& element) {
+  emplace(std::move(element));
+}
+
+template <typename T, std::size_t N>
+template <typename... Args>
+T& Stack<T, N>::emplace(Args&&... args) {
+  if (count == capacity) {
+    return growAndEmplace(std::forward<Args>(args)...);
+  }
+  T* slot = new (elements + count) T(std::forward<Args>(args)...);
+  count++;
+  return *slot;
+}
+
+template <typename T, std::size_t N>
+T Stack<T, N>::pop() noexcept {
+  assert(count > 0 && "pop() on an empty Stack");
+  count--;
+  T tmp(std::move(elements[count]));
+  elements[count].~T();
+  return tmp;
+}
+
+template <typename T, std::size_t N>
+std::optional<T> Stack<T, N>::try_pop() noexcept {
+  if (count == 0) {
+    return std::nullopt;
+  }
+  count--;
+  std::optional<T> tmp(std::move(elements[count]));
+  elements[count].~T();
+  return tmp;
+}
+
+template <typename T, std::size_t N>
+T& Stack<T, N>::top() noexcept {
+  assert(count > 0 && "top() on an empty Stack");
+  return elements[count - 1];
+}
@@ -0,0 +1,136 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "ConcurrentStack.h"
+#include "Stack.h"
+
+using std::cout;
+using std::endl;
+
+const int kOperationsPerThread = 1000000;
+
+// The vector-backed Stack behind one mutex, as the work pool used to be
+class LockedStack {
+ private:
+  Stack<long> stack;
+  std::mutex mutex;
+
+ public:
+  void push(long element) {
+    std::lock_guard<std::mutex> lock(mutex);
+    stack.push(element);
+  }
+
+  bool try_pop(long& element) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (stack.empty()) {
+      return false;
+    }
+    element = stack.pop();
+    return true;
+  }
+};
+
+bool pop(ConcurrentStack<long>& stack, long& element) {
+  std::optional<long> popped = stack.try_pop();
+  if (popped) {
+    element = *popped;
+  }
+  return popped.has_value();
+}
+
+bool pop(LockedStack& stack, long& element) { return stack.try_pop(element); }
+
+// Each thread pushes a burst of values then pops a burst, so every thread
+// keeps hitting the shared head. The popped values must add up to exactly
+// what was pushed.
+template <typename Pool>
+double run(int threads) {
+  Pool pool;
+  std::atomic<bool> start(false);
+  std::atomic<long> pushedSum(0), poppedSum(0);
+  std::vector<std::thread> workers;
+
+  for (int t = 0; t < threads; t++) {
+    workers.emplace_back([&, t]() {
+      long pushed = 0, popped = 0, element;
+      while (!start.load()) {
+      }
+      for (int i = 0; i < kOperationsPerThread; i += 16) {
+        for (int j = 0; j < 8; j++) {
+          long value = static_cast<long>(t) * kOperationsPerThread + i + j;
+          pool.push(value);
+          pushed += value;
+        }
+        for (int j = 0; j < 8; j++) {
+          if (pop(pool, element)) {
+            popped += element;
+          }
+        }
+      }
+      pushedSum.fetch_add(pushed);
+      poppedSum.fetch_add(popped);
+    });
+  }
+
+  auto begin = std::chrono::steady_clock::now();
+  start.store(true);
+  for (std::thread& worker : workers) {
+    worker.join();
+  }
+  double seconds = std::chrono::duration<double>(
+                       std::chrono::steady_clock::now() - begin)
+                       .count();
+
+  long leftover = 0, element;
+  while (pop(pool, element)) {
+    leftover += element;
+  }
+  if (poppedSum.load() + leftover != pushedSum.load()) {
+    throw std::runtime_error("Stack lost or duplicated elements");
+  }
+  return threads * static_cast<double>(kOperationsPerThread) / seconds / 1e6;
+}
+
+// Usage: concurrentBenchmark [max threads]
+int main(int argc, char* argv[]) {
+  int maxThreads = argc > 1 ? std::atoi(argv[1])
+                            : std::thread::hardware_concurrency();
+  maxThreads = std::max(1, maxThreads);
+
+  // Move-only elements go through emplace and come back out of try_pop
+  ConcurrentStack<std::unique_ptr<int>> tasks;
+  tasks.emplace(new int(42));
+  std::optional<std::unique_ptr<int>> task = tasks.try_pop();
+  cout << "Move-only element popped: " << **task << endl << endl;
+
+  cout << "Contended push/pop, " << kOperationsPerThread
+       << " operations per thread" << endl;
+  cout << std::setw(8) << "threads" << std::setw(18) << "lock-free Mops/s"
+       << std::setw(18) << "mutex Mops/s" << endl;
+  cout << std::fixed << std::setprecision(2);
+
+  std::vector<int> threadCounts;
+  for (int t = 1; t < maxThreads; t *= 2) {
+    threadCounts.push_back(t);
+  }
+  threadCounts.push_back(maxThreads);
+
+  for (int threads : threadCounts) {
+    double lockFree = run<ConcurrentStack<long>>(threads);
+    double locked = run<LockedStack>(threads);
+    cout << std::setw(8) << threads << std::setw(18) << lockFree
+         << std::setw(18) << locked << endl;
+  }
+
+  return 0;
+}
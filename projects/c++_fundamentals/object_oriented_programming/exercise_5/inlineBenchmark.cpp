@@ -0,0 +1,78 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "Stack.h"
+
+using std::cout;
+using std::endl;
+
+const int kFrames = 200000;
+
+// A large undo entry: which command ran plus enough state to revert it
+struct UndoCommand {
+  int type;
+  double before[7];
+
+  UndoCommand(int type = 0) : type(type) {
+    for (double& value : before) {
+      value = type;
+    }
+  }
+};
+
+long checksum(int value) { return value; }
+long checksum(const UndoCommand& command) {
+  return command.type + static_cast<long>(command.before[6]);
+}
+
+// Every frame builds a fresh undo stack, pushes `depth` entries and unwinds
+// it, like a per-frame scratch stack. Returns millions of push+pop pairs per
+// second.
+template <typename StackType, typename Element>
+double run(int depth, long& sink) {
+  auto begin = std::chrono::steady_clock::now();
+  for (int frame = 0; frame < kFrames; frame++) {
+    StackType stack;
+    for (int i = 0; i < depth; i++) {
+      stack.emplace(frame + i);
+    }
+    while (std::optional<Element> element = stack.try_pop()) {
+      sink += checksum(*element);
+    }
+  }
+  double seconds = std::chrono::duration<double>(
+                       std::chrono::steady_clock::now() - begin)
+                       .count();
+  return static_cast<double>(kFrames) * depth / seconds / 1e6;
+}
+
+template <typename Element>
+void compare(const std::string& name, long& sink) {
+  cout << endl << name << " (" << sizeof(Element) << " bytes)" << endl;
+  cout << std::setw(8) << "depth" << std::setw(16) << "Stack<T>"
+       << std::setw(16) << "Stack<T, 32>" << std::setw(10) << "speedup"
+       << endl;
+  for (int depth : {4, 16, 32, 128}) {
+    double vectorRate = run<Stack<Element>, Element>(depth, sink);
+    double inlineRate = run<Stack<Element, 32>, Element>(depth, sink);
+    cout << std::setw(8) << depth << std::setw(16) << vectorRate
+         << std::setw(16) << inlineRate << std::setw(10)
+         << inlineRate / vectorRate << endl;
+  }
+}
+
+int main() {
+  long sink = 0;
+  cout << "Push/pop throughput in millions of pairs per second, " << kFrames
+       << " frames" << endl;
+  cout << "Depths above 32 overflow the inline buffer onto the heap" << endl;
+  cout << std::fixed << std::setprecision(2);
+
+  compare<int>("int", sink);
+  compare<UndoCommand>("UndoCommand", sink);
+
+  cout << endl << "checksum " << sink << endl;
+  return 0;
+}
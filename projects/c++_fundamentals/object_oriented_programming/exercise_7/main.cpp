@@ -28,7 +28,7 @@ class Employee {
 
 class TeachingAssistant : public Employee, public Student {
  public:
-  TeachingAssistant(int id) : Student(id), Employee(id) {}
+  TeachingAssistant(int id) : Employee(id), Student(id) {}
 
   void getId() {
     Employee::getId();
@@ -0,0 +1,154 @@
+#include "Ledger.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+void Ledger::checkAccount(AccountId id) const {
+  if (id >= accounts.size()) {
+    throw std::out_of_range("Unknown account " + std::to_string(id));
+  }
+}
+
+void Ledger::appendAudit(const std::vector<Posting>& postings) {
+  std::lock_guard<std::mutex> lock(auditMutex);
+  audit.push_back({audit.size(), postings});
+}
+
+AccountId Ledger::openAccount(const std::string& owner, Money initial) {
+  if (initial < Money()) {
+    throw std::invalid_argument("Opening balance cannot be negative");
+  }
+  std::unique_lock<std::shared_mutex> lock(accountsMutex);
+  AccountId id = static_cast<AccountId>(accounts.size());
+  accounts.emplace_back();
+  accounts.back().balance = initial;
+  accounts.back().owner = owner;
+  appendAudit({{id, initial}});
+  return id;
+}
+
+bool Ledger::transfer(AccountId from, AccountId to, Money amount) {
+  if (amount < Money()) {
+    throw std::invalid_argument("Transfer amount cannot be negative");
+  }
+  return apply({{from, -amount}, {to, amount}});
+}
+
+bool Ledger::apply(const std::vector<Posting>& postings) {
+  Money sum;
+  for (const Posting& posting : postings) {
+    sum += posting.amount;
+  }
+  if (sum != Money()) {
+    throw std::invalid_argument("Postings must sum to zero");
+  }
+
+  std::shared_lock<std::shared_mutex> accountsLock(accountsMutex);
+  std::vector<AccountId> ids;
+  for (const Posting& posting : postings) {
+    checkAccount(posting.account);
+    ids.push_back(posting.account);
+  }
+  std::sort(ids.begin(), ids.end());
+  ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+
+  // Always in ascending id order, so no two transactions deadlock
+  for (AccountId id : ids) {
+    accounts[id].lock.lock();
+  }
+  auto unlockAll = [&]() {
+    for (auto id = ids.rbegin(); id != ids.rend(); ++id) {
+      accounts[*id].lock.unlock();
+    }
+  };
+
+  // Net change per account first, so an account may appear more than once
+  std::vector<Money> after(ids.size());
+  for (size_t i = 0; i < ids.size(); i++) {
+    after[i] = accounts[ids[i]].balance;
+  }
+  try {
+    for (const Posting& posting : postings) {
+      size_t slot = std::lower_bound(ids.begin(), ids.end(), posting.account) -
+                    ids.begin();
+      after[slot] += posting.amount;
+    }
+  } catch (...) {
+    unlockAll();
+    throw;
+  }
+  for (const Money& balance : after) {
+    if (balance < Money()) {
+      unlockAll();
+      return false;
+    }
+  }
+
+  // Log first: if the append throws, no balance has changed yet
+  try {
+    appendAudit(postings);
+  } catch (...) {
+    unlockAll();
+    throw;
+  }
+  for (size_t i = 0; i < ids.size(); i++) {
+    accounts[ids[i]].balance = after[i];
+  }
+  unlockAll();
+  return true;
+}
+
+Money Ledger::balance(AccountId id) const {
+  std::shared_lock<std::shared_mutex> accountsLock(accountsMutex);
+  checkAccount(id);
+  std::lock_guard<std::mutex> lock(accounts[id].lock);
+  return accounts[id].balance;
+}
+
+const std::string& Ledger::owner(AccountId id) const {
+  std::shared_lock<std::shared_mutex> accountsLock(accountsMutex);
+  checkAccount(id);
+  return accounts[id].owner;
+}
+
+size_t Ledger::accountCount() const {
+  std::shared_lock<std::shared_mutex> accountsLock(accountsMutex);
+  return accounts.size();
+}
+
+Money Ledger::total() const {
+  // Exclusive access waits for running transactions and holds off new ones
+  std::unique_lock<std::shared_mutex> accountsLock(accountsMutex);
+  Money sum;
+  for (const Account& account : accounts) {
+    sum += account.balance;
+  }
+  return sum;
+}
+
+size_t Ledger::auditSize() const {
+  std::lock_guard<std::mutex> lock(auditMutex);
+  return audit.size();
+}
+
+std::vector<AuditEntry> Ledger::auditLog() const {
+  std::lock_guard<std::mutex> lock(auditMutex);
+  return audit;
+}
+
+bool Ledger::verifyAudit() const {
+  std::unique_lock<std::shared_mutex> accountsLock(accountsMutex);
+  std::lock_guard<std::mutex> lock(auditMutex);
+  std::vector<Money> replayed(accounts.size());
+  for (const AuditEntry& entry : audit) {
+    for (const Posting& posting : entry.postings) {
+      replayed[posting.account] += posting.amount;
+    }
+  }
+  for (size_t id = 0; id < accounts.size(); id++) {
+    if (replayed[id] != accounts[id].balance) {
+      return false;
+    }
+  }
+  return true;
+}
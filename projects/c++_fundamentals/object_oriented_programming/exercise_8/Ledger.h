@@ -0,0 +1,86 @@
+#ifndef LEDGER_H
+#define LEDGER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+#include "Money.h"
+
+typedef uint32_t AccountId;
+
+// One leg of a transaction: amount is added to the account (negative for
+// the paying side)
+struct Posting {
+  AccountId account;
+  Money amount;
+};
+
+// An applied transaction. Account openings are recorded as a single
+// posting of the opening balance; every other entry sums to zero.
+struct AuditEntry {
+  uint64_t sequence;
+  std::vector<Posting> postings;
+};
+
+// Balances for many accounts with atomic multi-account transactions.
+//
+// A transaction locks every account it touches in ascending id order, so
+// two transactions can never wait on each other in a cycle, and
+// transactions over disjoint accounts run in parallel. Each applied
+// transaction is appended to an audit log while its accounts are still
+// locked, so replaying the log in sequence order reproduces the balances.
+class Ledger {
+ private:
+  struct alignas(64) Account {
+    mutable std::mutex lock;
+    Money balance;
+    std::string owner;
+  };
+
+  // Held shared by transactions and exclusively while opening accounts or
+  // reading every balance at once
+  mutable std::shared_mutex accountsMutex;
+  std::deque<Account> accounts;
+
+  mutable std::mutex auditMutex;
+  std::vector<AuditEntry> audit;
+
+  void appendAudit(const std::vector<Posting>& postings);
+  void checkAccount(AccountId id) const;
+
+ public:
+  Ledger() {}
+  Ledger(const Ledger&) = delete;
+  Ledger& operator=(const Ledger&) = delete;
+
+  AccountId openAccount(const std::string& owner, Money initial = Money());
+
+  // Moves amount from one account to another. Returns false, changing
+  // nothing, if from cannot afford it.
+  bool transfer(AccountId from, AccountId to, Money amount);
+
+  // Applies every posting or none. The postings must sum to zero; returns
+  // false, changing nothing, if any balance would go negative.
+  bool apply(const std::vector<Posting>& postings);
+
+  Money balance(AccountId id) const;
+  const std::string& owner(AccountId id) const;
+  size_t accountCount() const;
+
+  // Sum of all balances as of one instant between transactions
+  Money total() const;
+
+  size_t auditSize() const;
+  std::vector<AuditEntry> auditLog() const;
+
+  // Rebuilds every balance from the audit log and compares with the live
+  // balances
+  bool verifyAudit() const;
+};
+
+#endif  // LEDGER_H
@@ -0,0 +1,79 @@
+#ifndef MONEY_H
+#define MONEY_H
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+// Currency as a 64-bit count of ten-thousandths of a coin. Integer math
+// keeps every sum exact, and overflow throws instead of wrapping.
+class Money {
+ private:
+  int64_t units;
+
+  explicit Money(int64_t units) : units(units) {}
+
+ public:
+  static const int64_t kUnitsPerCoin = 10000;
+
+  Money() : units(0) {}
+
+  static Money fromUnits(int64_t units) { return Money(units); }
+
+  static Money fromCoins(int64_t coins) {
+    int64_t units;
+    if (__builtin_mul_overflow(coins, kUnitsPerCoin, &units)) {
+      throw std::overflow_error("Money overflow");
+    }
+    return Money(units);
+  }
+
+  int64_t getUnits() const { return units; }
+
+  Money operator+(Money rhs) const {
+    int64_t sum;
+    if (__builtin_add_overflow(units, rhs.units, &sum)) {
+      throw std::overflow_error("Money overflow");
+    }
+    return Money(sum);
+  }
+
+  Money operator-(Money rhs) const {
+    int64_t difference;
+    if (__builtin_sub_overflow(units, rhs.units, &difference)) {
+      throw std::overflow_error("Money overflow");
+    }
+    return Money(difference);
+  }
+
+  Money operator-() const { return Money() - *this; }
+
+  Money operator*(int64_t factor) const {
+    int64_t product;
+    if (__builtin_mul_overflow(units, factor, &product)) {
+      throw std::overflow_error("Money overflow");
+    }
+    return Money(product);
+  }
+
+  Money& operator+=(Money rhs) { return *this = *this + rhs; }
+  Money& operator-=(Money rhs) { return *this = *this - rhs; }
+
+  bool operator==(Money rhs) const { return units == rhs.units; }
+  bool operator!=(Money rhs) const { return units != rhs.units; }
+  bool operator<(Money rhs) const { return units < rhs.units; }
+  bool operator<=(Money rhs) const { return units <= rhs.units; }
+  bool operator>(Money rhs) const { return units > rhs.units; }
+  bool operator>=(Money rhs) const { return units >= rhs.units; }
+
+  // "-12.0500"
+  std::string toString() const {
+    uint64_t magnitude = units < 0 ? 0 - uint64_t(units) : uint64_t(units);
+    std::string fraction = std::to_string(magnitude % kUnitsPerCoin);
+    fraction.insert(0, 4 - fraction.size(), '0');
+    return (units < 0 ? "-" : "") + std::to_string(magnitude / kUnitsPerCoin) +
+           "." + fraction;
+  }
+};
+
+#endif  // MONEY_H
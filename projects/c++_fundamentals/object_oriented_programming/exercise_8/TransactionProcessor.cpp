@@ -0,0 +1,356 @@
+#include "TransactionProcessor.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <system_error>
+
+// Log format: a sequence of records, each
+//   uint32 payload length | uint32 FNV-1a checksum of the length |
+//   payload | uint32 FNV-1a checksum of payload
+// with the payload
+//   Open:  uint8 1 | int64 initial units | uint32 owner length | owner
+//   Apply: uint8 2 | uint32 count | count * (uint32 account | int64 units)
+// Integers are written in host byte order (little-endian on x86 and ARM).
+// The length has its own checksum so that a damaged length cannot make a
+// record look like it runs past the end of the file, i.e. like a torn tail.
+
+namespace {
+
+uint32_t checksum(const char* data, size_t size) {
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < size; i++) {
+    hash ^= static_cast<unsigned char>(data[i]);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+template <typename T>
+void put(std::vector<char>& out, T value) {
+  const char* bytes = reinterpret_cast<const char*>(&value);
+  out.insert(out.end(), bytes, bytes + sizeof(T));
+}
+
+// Reads a T at offset, advancing it; false if the payload is too short
+template <typename T>
+bool take(const std::vector<char>& in, size_t end, size_t& offset, T& value) {
+  if (end - offset < sizeof(T)) {
+    return false;
+  }
+  std::memcpy(&value, in.data() + offset, sizeof(T));
+  offset += sizeof(T);
+  return true;
+}
+
+void throwErrno(const std::string& what) {
+  throw std::system_error(errno, std::generic_category(), what);
+}
+
+}  // namespace
+
+TransactionProcessor::TransactionProcessor(const std::string& logPath,
+                                           ProcessorOptions options)
+    : options(options),
+      fd(-1),
+      replayedCount(0),
+      stopping(false),
+      applierDone(false),
+      submitted(0),
+      durableCount(0) {
+  if (this->options.maxBatch == 0) {
+    throw std::invalid_argument("maxBatch must be at least 1");
+  }
+  replay(logPath);
+  applier = std::thread(&TransactionProcessor::applyLoop, this);
+  writer = std::thread(&TransactionProcessor::writeLoop, this);
+}
+
+TransactionProcessor::~TransactionProcessor() {
+  {
+    std::lock_guard<std::mutex> lock(queueMutex);
+    stopping = true;
+  }
+  queueReady.notify_all();
+  applier.join();
+  writer.join();
+  close(fd);
+}
+
+void TransactionProcessor::replay(const std::string& logPath) {
+  std::vector<char> log;
+  {
+    std::ifstream in(logPath, std::ios::binary);
+    log.assign(std::istreambuf_iterator<char>(in),
+               std::istreambuf_iterator<char>());
+  }
+
+  size_t offset = 0;
+  while (true) {
+    size_t start = offset;
+    uint32_t length, lengthChecksum, stored;
+    if (!take(log, log.size(), offset, length) ||
+        !take(log, log.size(), offset, lengthChecksum)) {
+      offset = start;
+      break;
+    }
+    if (lengthChecksum !=
+        checksum(reinterpret_cast<const char*>(&length), sizeof(length))) {
+      throw std::runtime_error("Corrupt transaction log record");
+    }
+    // The length is good, so a record running past the end was torn
+    if (log.size() - offset < size_t(length) + sizeof(uint32_t)) {
+      offset = start;
+      break;
+    }
+    size_t payloadEnd = offset + length;
+    std::memcpy(&stored, log.data() + payloadEnd, sizeof(stored));
+    if (stored != checksum(log.data() + offset, length)) {
+      // Only the last record can be torn. A bad one with records after it
+      // is damage, and cutting there would drop acknowledged batches.
+      if (payloadEnd + sizeof(uint32_t) != log.size()) {
+        throw std::runtime_error("Corrupt transaction log record");
+      }
+      offset = start;
+      break;
+    }
+
+    uint8_t type;
+    bool parsed = take(log, payloadEnd, offset, type);
+    if (parsed && type == uint8_t(Type::Open)) {
+      int64_t units;
+      uint32_t ownerLength;
+      parsed = take(log, payloadEnd, offset, units) &&
+               take(log, payloadEnd, offset, ownerLength) &&
+               payloadEnd - offset == ownerLength;
+      if (parsed) {
+        book.openAccount(std::string(log.data() + offset, ownerLength),
+                         Money::fromUnits(units));
+      }
+    } else if (parsed && type == uint8_t(Type::Apply)) {
+      uint32_t count;
+      parsed = take(log, payloadEnd, offset, count);
+      std::vector<Posting> postings;
+      for (uint32_t i = 0; parsed && i < count; i++) {
+        Posting posting;
+        int64_t units = 0;
+        parsed = take(log, payloadEnd, offset, posting.account) &&
+                 take(log, payloadEnd, offset, units);
+        posting.amount = Money::fromUnits(units);
+        postings.push_back(posting);
+      }
+      if (parsed && !book.apply(postings)) {
+        throw std::runtime_error("Log replay overdrew an account");
+      }
+    } else {
+      parsed = false;
+    }
+    if (!parsed) {
+      throw std::runtime_error("Corrupt transaction log record");
+    }
+    offset = payloadEnd + sizeof(uint32_t);
+    replayedCount++;
+  }
+
+  fd = open(logPath.c_str(), O_WRONLY | O_CREAT, 0644);
+  if (fd < 0) {
+    throwErrno("Cannot open " + logPath);
+  }
+  // Drop a torn tail so new records follow the last complete one
+  if (ftruncate(fd, offset) != 0 || lseek(fd, offset, SEEK_SET) < 0) {
+    int error = errno;
+    close(fd);
+    errno = error;
+    throwErrno("Cannot truncate " + logPath);
+  }
+}
+
+std::future<Outcome> TransactionProcessor::enqueue(Request request) {
+  request.queued = std::chrono::steady_clock::now();
+  std::future<Outcome> future = request.promise.get_future();
+  {
+    std::lock_guard<std::mutex> lock(queueMutex);
+    if (stopping) {
+      throw std::logic_error("TransactionProcessor is shutting down");
+    }
+    queue.push_back(std::move(request));
+  }
+  {
+    std::lock_guard<std::mutex> lock(statsMutex);
+    submitted++;
+  }
+  queueReady.notify_one();
+  return future;
+}
+
+std::future<Outcome> TransactionProcessor::openAccount(
+    const std::string& owner, Money initial) {
+  Request request;
+  request.type = Type::Open;
+  request.owner = owner;
+  request.amount = initial;
+  return enqueue(std::move(request));
+}
+
+std::future<Outcome> TransactionProcessor::transfer(AccountId from,
+                                                    AccountId to,
+                                                    Money amount) {
+  if (amount < Money()) {
+    throw std::invalid_argument("Transfer amount cannot be negative");
+  }
+  return submit({{from, -amount}, {to, amount}});
+}
+
+std::future<Outcome> TransactionProcessor::submit(
+    std::vector<Posting> postings) {
+  Request request;
+  request.type = Type::Apply;
+  request.postings = std::move(postings);
+  return enqueue(std::move(request));
+}
+
+void TransactionProcessor::applyRequest(Batch& batch, Request& request) {
+  Outcome outcome = {false, 0};
+  std::vector<char> payload;
+  put(payload, uint8_t(request.type));
+  if (request.type == Type::Open) {
+    outcome.account = book.openAccount(request.owner, request.amount);
+    outcome.applied = true;
+    put(payload, request.amount.getUnits());
+    put(payload, uint32_t(request.owner.size()));
+    payload.insert(payload.end(), request.owner.begin(), request.owner.end());
+  } else {
+    outcome.applied = book.apply(request.postings);
+    put(payload, uint32_t(request.postings.size()));
+    for (const Posting& posting : request.postings) {
+      put(payload, posting.account);
+      put(payload, posting.amount.getUnits());
+    }
+  }
+  batch.outcomes.push_back(outcome);
+  if (!outcome.applied) {
+    batch.rejected++;
+    return;
+  }
+  uint32_t length = uint32_t(payload.size());
+  put(batch.records, length);
+  put(batch.records,
+      checksum(reinterpret_cast<const char*>(&length), sizeof(length)));
+  batch.records.insert(batch.records.end(), payload.begin(), payload.end());
+  put(batch.records, checksum(payload.data(), payload.size()));
+}
+
+void TransactionProcessor::applyLoop() {
+  while (true) {
+    std::unique_ptr<Batch> batch(new Batch());
+    {
+      std::unique_lock<std::mutex> lock(queueMutex);
+      queueReady.wait(lock, [this] { return stopping || !queue.empty(); });
+      if (queue.empty()) {
+        break;
+      }
+      size_t take = std::min(queue.size(), options.maxBatch);
+      for (size_t i = 0; i < take; i++) {
+        batch->requests.push_back(std::move(queue.front()));
+        queue.pop_front();
+      }
+    }
+
+    for (Request& request : batch->requests) {
+      try {
+        applyRequest(*batch, request);
+        batch->errors.push_back(nullptr);
+      } catch (...) {
+        // Invalid request (unknown account, postings not summing to zero):
+        // nothing was applied or logged
+        batch->outcomes.push_back({false, 0});
+        batch->errors.push_back(std::current_exception());
+      }
+    }
+
+    std::unique_lock<std::mutex> lock(handoffMutex);
+    handoffReady.wait(lock, [this] { return pending == nullptr; });
+    pending = std::move(batch);
+    handoffReady.notify_all();
+  }
+
+  std::lock_guard<std::mutex> lock(handoffMutex);
+  applierDone = true;
+  handoffReady.notify_all();
+}
+
+void TransactionProcessor::writeLoop() {
+  while (true) {
+    std::unique_ptr<Batch> batch;
+    {
+      std::unique_lock<std::mutex> lock(handoffMutex);
+      handoffReady.wait(lock, [this] { return pending || applierDone; });
+      if (!pending) {
+        break;
+      }
+      batch = std::move(pending);
+      handoffReady.notify_all();
+    }
+
+    auto commitStart = std::chrono::steady_clock::now();
+    std::exception_ptr ioError;
+    size_t written = 0;
+    while (written < batch->records.size()) {
+      ssize_t result = write(fd, batch->records.data() + written,
+                             batch->records.size() - written);
+      if (result < 0 && errno == EINTR) {
+        continue;
+      }
+      if (result < 0) {
+        ioError = std::make_exception_ptr(
+            std::system_error(errno, std::generic_category(), "Log write"));
+        break;
+      }
+      written += result;
+    }
+    if (!ioError && options.durable && !batch->records.empty() &&
+        fdatasync(fd) != 0) {
+      ioError = std::make_exception_ptr(
+          std::system_error(errno, std::generic_category(), "Log sync"));
+    }
+    auto committed = std::chrono::steady_clock::now();
+
+    for (size_t i = 0; i < batch->requests.size(); i++) {
+      std::exception_ptr error = ioError ? ioError : batch->errors[i];
+      if (error) {
+        batch->requests[i].promise.set_exception(error);
+      } else {
+        batch->requests[i].promise.set_value(batch->outcomes[i]);
+      }
+    }
+
+    std::lock_guard<std::mutex> lock(statsMutex);
+    durableCount += batch->requests.size();
+    history.push_back(
+        {batch->requests.size(), batch->rejected,
+         std::chrono::duration_cast<std::chrono::microseconds>(
+             committed - batch->requests.front().queued),
+         std::chrono::duration_cast<std::chrono::microseconds>(
+             committed - commitStart)});
+    durableAdvanced.notify_all();
+  }
+}
+
+void TransactionProcessor::flush() {
+  std::unique_lock<std::mutex> lock(statsMutex);
+  uint64_t target = submitted;
+  durableAdvanced.wait(lock, [&] { return durableCount >= target; });
+}
+
+std::vector<BatchStats> TransactionProcessor::takeBatchStats() {
+  std::lock_guard<std::mutex> lock(statsMutex);
+  std::vector<BatchStats> taken;
+  taken.swap(history);
+  return taken;
+}
@@ -0,0 +1,139 @@
+#ifndef TRANSACTION_PROCESSOR_H
+#define TRANSACTION_PROCESSOR_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Ledger.h"
+#include "Money.h"
+
+struct ProcessorOptions {
+  // Most operations applied and written together
+  size_t maxBatch = 1024;
+  // fdatasync after every batch; turn off only for measurements
+  bool durable = true;
+};
+
+// What happened to one submitted operation once its batch is on disk
+struct Outcome {
+  bool applied;       // false if it would have overdrawn an account
+  AccountId account;  // The new account, for openAccount
+};
+
+struct BatchStats {
+  size_t operations;
+  size_t rejected;
+  // From the oldest operation in the batch being queued to the batch
+  // being durable, i.e. the worst latency any caller in it saw
+  std::chrono::microseconds latency;
+  // Time spent in write + fdatasync
+  std::chrono::microseconds commitTime;
+};
+
+// Applies ledger operations in batches with one log write per batch
+// (group commit).
+//
+// Callers queue operations and get a future. An applier thread takes
+// everything queued (up to maxBatch), applies it to the ledger in order and
+// encodes the applied operations as log records. A writer thread appends
+// the whole batch to the log with one write and one fdatasync, then
+// completes the batch's futures. The two threads overlap: while one batch
+// is being synced the next is being applied. A future therefore resolves
+// only once its operation is durable, though ledger() may briefly show
+// applied operations whose batch is still being written.
+//
+// If a write or sync fails, every future in that batch reports the error;
+// the ledger is then ahead of the log and the processor should be rebuilt
+// from the log.
+//
+// On construction the existing log is replayed into the ledger. A torn
+// record at the end (a crash mid-write) is cut off; its batch was never
+// acknowledged. A bad record anywhere else throws std::runtime_error and
+// leaves the file as it was.
+class TransactionProcessor {
+ private:
+  enum class Type : uint8_t { Open = 1, Apply = 2 };
+
+  struct Request {
+    Type type;
+    std::string owner;
+    Money amount;
+    std::vector<Posting> postings;
+    std::promise<Outcome> promise;
+    std::chrono::steady_clock::time_point queued;
+  };
+
+  struct Batch {
+    std::vector<char> records;
+    std::vector<Request> requests;
+    std::vector<Outcome> outcomes;
+    std::vector<std::exception_ptr> errors;
+    size_t rejected = 0;
+  };
+
+  ProcessorOptions options;
+  Ledger book;
+  int fd;
+  size_t replayedCount;
+
+  std::mutex queueMutex;
+  std::condition_variable queueReady;
+  std::deque<Request> queue;
+  bool stopping;
+
+  // Hand-off of one applied batch from the applier to the writer
+  std::mutex handoffMutex;
+  std::condition_variable handoffReady;
+  std::unique_ptr<Batch> pending;
+  bool applierDone;
+
+  std::mutex statsMutex;
+  std::condition_variable durableAdvanced;
+  uint64_t submitted;
+  uint64_t durableCount;
+  std::vector<BatchStats> history;
+
+  std::thread applier;
+  std::thread writer;
+
+  void replay(const std::string& logPath);
+  std::future<Outcome> enqueue(Request request);
+  void applyLoop();
+  void writeLoop();
+  void applyRequest(Batch& batch, Request& request);
+
+ public:
+  explicit TransactionProcessor(const std::string& logPath,
+                                ProcessorOptions options = ProcessorOptions());
+  // Finishes and syncs everything already queued
+  ~TransactionProcessor();
+
+  TransactionProcessor(const TransactionProcessor&) = delete;
+  TransactionProcessor& operator=(const TransactionProcessor&) = delete;
+
+  std::future<Outcome> openAccount(const std::string& owner,
+                                   Money initial = Money());
+  std::future<Outcome> transfer(AccountId from, AccountId to, Money amount);
+  // Postings must sum to zero, as for Ledger::apply
+  std::future<Outcome> submit(std::vector<Posting> postings);
+
+  // Blocks until everything submitted before the call is durable
+  void flush();
+
+  const Ledger& ledger() const { return book; }
+  // Operations read back from the log at startup
+  size_t replayed() const { return replayedCount; }
+  // Stats for every batch since the last call
+  std::vector<BatchStats> takeBatchStats();
+};
+
+#endif  // TRANSACTION_PROCESSOR_H
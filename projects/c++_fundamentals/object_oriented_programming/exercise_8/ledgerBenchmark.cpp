@@ -0,0 +1,109 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Ledger.h"
+#include "Money.h"
+
+using std::cout;
+using std::endl;
+
+const int kTransactionsPerThread = 200000;
+const int64_t kOpeningCoins = 1000;
+
+struct RunResult {
+  double seconds;
+  uint64_t applied, rejected;
+};
+
+// Every thread makes random two-way transfers, with every fourth
+// transaction a three-way split, between accounts of one ledger
+RunResult run(Ledger& ledger, int threads, unsigned seed) {
+  std::atomic<uint64_t> applied(0), rejected(0);
+  AccountId accounts = static_cast<AccountId>(ledger.accountCount());
+  auto worker = [&](unsigned threadSeed) {
+    std::mt19937 rng(threadSeed);
+    std::uniform_int_distribution<AccountId> pick(0, accounts - 1);
+    std::uniform_int_distribution<int64_t> units(1, 50 * Money::kUnitsPerCoin);
+    uint64_t ok = 0, failed = 0;
+    for (int i = 0; i < kTransactionsPerThread; i++) {
+      bool done;
+      Money amount = Money::fromUnits(units(rng));
+      if (i % 4 == 3) {
+        Money half = Money::fromUnits(amount.getUnits() / 2);
+        done = ledger.apply({{pick(rng), -amount},
+                             {pick(rng), half},
+                             {pick(rng), amount - half}});
+      } else {
+        done = ledger.transfer(pick(rng), pick(rng), amount);
+      }
+      (done ? ok : failed)++;
+    }
+    applied += ok;
+    rejected += failed;
+  };
+
+  auto begin = std::chrono::steady_clock::now();
+  std::vector<std::thread> pool;
+  for (int t = 0; t < threads; t++) {
+    pool.emplace_back(worker, seed + t);
+  }
+  for (std::thread& thread : pool) {
+    thread.join();
+  }
+  double seconds = std::chrono::duration<double>(
+                       std::chrono::steady_clock::now() - begin)
+                       .count();
+  return {seconds, applied.load(), rejected.load()};
+}
+
+// Usage: ledgerBenchmark [max threads]
+int main(int argc, char* argv[]) {
+  int maxThreads = argc > 1 ? std::atoi(argv[1])
+                            : std::thread::hardware_concurrency();
+  maxThreads = std::max(1, maxThreads);
+
+  std::vector<int> threadCounts;
+  for (int t = 1; t < maxThreads; t *= 2) {
+    threadCounts.push_back(t);
+  }
+  threadCounts.push_back(maxThreads);
+
+  cout << kTransactionsPerThread << " transactions per thread" << endl;
+  cout << std::setw(10) << "accounts" << std::setw(9) << "threads"
+       << std::setw(14) << "tx/s" << std::setw(11) << "rejected"
+       << std::setw(12) << "conserved" << std::setw(10) << "audit" << endl;
+  cout << std::fixed << std::setprecision(0);
+
+  bool allGood = true;
+  // Many accounts means little contention; 16 accounts means a lot
+  for (AccountId accountCount : {AccountId(100000), AccountId(16)}) {
+    for (int threads : threadCounts) {
+      Ledger ledger;
+      for (AccountId id = 0; id < accountCount; id++) {
+        ledger.openAccount("player" + std::to_string(id),
+                           Money::fromCoins(kOpeningCoins));
+      }
+      Money expected = Money::fromCoins(kOpeningCoins) * accountCount;
+
+      RunResult result = run(ledger, threads, 1234);
+      bool conserved = ledger.total() == expected;
+      bool audited = ledger.verifyAudit() &&
+                     ledger.auditSize() == accountCount + result.applied;
+      allGood = allGood && conserved && audited;
+      uint64_t transactions = result.applied + result.rejected;
+      cout << std::setw(10) << accountCount << std::setw(9) << threads
+           << std::setw(14) << transactions / result.seconds << std::setw(11)
+           << result.rejected << std::setw(12) << (conserved ? "yes" : "NO")
+           << std::setw(10) << (audited ? "ok" : "BAD") << endl;
+    }
+  }
+  return allGood ? 0 : 1;
+}
@@ -1,6 +1,7 @@
 #include <iostream>
 
 #include "Bank.h"
+#include "Ledger.h"
 
 using std::cout;
 using std::endl;
@@ -14,5 +15,24 @@ int main() {
 
   updateBalance(account, 20);
   account.showBalance();
+
+  // The in-game economy keeps many accounts in one ledger
+  Ledger ledger;
+  AccountId shop = ledger.openAccount("shop");
+  AccountId igor = ledger.openAccount("Igor", Money::fromCoins(20));
+  AccountId guild = ledger.openAccount("guild");
+  ledger.transfer(igor, shop, Money::fromUnits(125000));
+
+  // Sale with a 10% guild cut, applied as one transaction
+  Money price = Money::fromCoins(5);
+  Money cut = Money::fromUnits(price.getUnits() / 10);
+  ledger.apply({{igor, -price}, {shop, price - cut}, {guild, cut}});
+
+  bool tooExpensive = !ledger.transfer(igor, shop, Money::fromCoins(100));
+  for (AccountId id : {shop, igor, guild}) {
+    cout << ledger.owner(id) << ": " << ledger.balance(id).toString() << endl;
+  }
+  cout << "Rejected overdraft: " << (tooExpensive ? "yes" : "no")
+       << ", audit entries: " << ledger.auditSize() << endl;
   return 0;
 }
\ No newline at end of file
@@ -0,0 +1,209 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <fstream>
+#include <future>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Money.h"
+#include "TransactionProcessor.h"
+
+using std::cout;
+using std::endl;
+
+const AccountId kAccounts = 10000;
+const int kProducers = 8;
+const int kOperationsPerProducer = 20000;
+// Operations each producer keeps in flight, like clients awaiting replies
+const size_t kWindow = 64;
+
+// Load generator: producers submit random transfers and wait for the
+// oldest reply whenever they have kWindow outstanding
+void generateLoad(TransactionProcessor& processor, unsigned seed) {
+  std::vector<std::thread> producers;
+  for (int p = 0; p < kProducers; p++) {
+    producers.emplace_back([&processor, p, seed]() {
+      std::mt19937 rng(seed + p);
+      std::uniform_int_distribution<AccountId> pick(0, kAccounts - 1);
+      std::uniform_int_distribution<int64_t> units(1,
+                                                   20 * Money::kUnitsPerCoin);
+      std::deque<std::future<Outcome>> inFlight;
+      for (int i = 0; i < kOperationsPerProducer; i++) {
+        if (inFlight.size() == kWindow) {
+          inFlight.front().get();
+          inFlight.pop_front();
+        }
+        inFlight.push_back(processor.transfer(
+            pick(rng), pick(rng), Money::fromUnits(units(rng))));
+      }
+      for (std::future<Outcome>& reply : inFlight) {
+        reply.get();
+      }
+    });
+  }
+  for (std::thread& producer : producers) {
+    producer.join();
+  }
+}
+
+long long percentile(std::vector<long long> values, double fraction) {
+  if (values.empty()) {
+    return 0;
+  }
+  size_t index = static_cast<size_t>(fraction * (values.size() - 1));
+  std::nth_element(values.begin(), values.begin() + index, values.end());
+  return values[index];
+}
+
+// Damages the first record of the log at logPath, once in its payload and
+// once in its length, then checks that reopening refuses it and leaves
+// every byte in place, rather than truncating the log at the damage.
+// Flipping a byte of the last record instead must cut off just that record.
+bool corruptionDetected(const std::string& logPath) {
+  std::remove(logPath.c_str());
+  {
+    TransactionProcessor processor(logPath, ProcessorOptions());
+    for (int i = 0; i < 3; i++) {
+      processor.openAccount("player" + std::to_string(i),
+                            Money::fromCoins(100));
+    }
+    processor.flush();
+  }
+  std::vector<char> original;
+  {
+    std::ifstream in(logPath, std::ios::binary);
+    original.assign(std::istreambuf_iterator<char>(in),
+                    std::istreambuf_iterator<char>());
+  }
+  auto writeLog = [&logPath](const std::vector<char>& bytes) {
+    std::ofstream out(logPath, std::ios::binary | std::ios::trunc);
+    out.write(bytes.data(), bytes.size());
+  };
+  auto logSize = [&logPath]() {
+    std::ifstream in(logPath, std::ios::binary | std::ios::ate);
+    return size_t(in.tellg());
+  };
+
+  auto refusedAndKept = [&](size_t position, char flip) {
+    std::vector<char> damaged = original;
+    damaged[position] ^= flip;
+    writeLog(damaged);
+    bool refused = false;
+    try {
+      TransactionProcessor reopened(logPath, ProcessorOptions());
+    } catch (const std::runtime_error&) {
+      refused = true;
+    }
+    return refused && logSize() == original.size();
+  };
+  // The first record's payload starts after its length and the length's
+  // checksum. A high bit in the length makes the record reach past the end.
+  bool payloadRefused = refusedAndKept(2 * sizeof(uint32_t) + 1, 1);
+  bool lengthRefused = refusedAndKept(sizeof(uint32_t) - 1, 0x10);
+
+  std::vector<char> damaged = original;
+  damaged[original.size() - 1] ^= 1;
+  writeLog(damaged);
+  size_t replayed;
+  {
+    TransactionProcessor reopened(logPath, ProcessorOptions());
+    replayed = reopened.replayed();
+  }
+  std::remove(logPath.c_str());
+  return payloadRefused && lengthRefused && replayed == 2;
+}
+
+// Usage: processorBenchmark [log directory]
+int main(int argc, char* argv[]) {
+  std::string directory = argc > 1 ? argv[1] : ".";
+  std::string logPath = directory + "/processorBenchmark.log";
+
+  cout << kProducers << " producers x " << kOperationsPerProducer
+       << " transfers, " << kWindow << " in flight each, log at " << logPath
+       << endl;
+  cout << std::setw(10) << "max batch" << std::setw(9) << "durable"
+       << std::setw(12) << "tx/s" << std::setw(11) << "avg batch"
+       << std::setw(14) << "p50 lat us" << std::setw(14) << "p99 lat us"
+       << std::setw(14) << "avg sync us" << endl;
+
+  bool allGood = true;
+  struct Config {
+    size_t maxBatch;
+    bool durable;
+  };
+  for (Config config : {Config{1, true}, Config{64, true}, Config{1024, true},
+                        Config{1024, false}}) {
+    std::remove(logPath.c_str());
+    ProcessorOptions options;
+    options.maxBatch = config.maxBatch;
+    options.durable = config.durable;
+
+    Money total;
+    std::vector<Money> balances;
+    double seconds;
+    std::vector<BatchStats> stats;
+    {
+      TransactionProcessor processor(logPath, options);
+      for (AccountId id = 0; id < kAccounts; id++) {
+        processor.openAccount("player" + std::to_string(id),
+                              Money::fromCoins(100));
+      }
+      processor.flush();
+      processor.takeBatchStats();
+
+      auto begin = std::chrono::steady_clock::now();
+      generateLoad(processor, 99);
+      seconds = std::chrono::duration<double>(
+                    std::chrono::steady_clock::now() - begin)
+                    .count();
+      stats = processor.takeBatchStats();
+      total = processor.ledger().total();
+      for (AccountId id = 0; id < kAccounts; id++) {
+        balances.push_back(processor.ledger().balance(id));
+      }
+    }
+
+    std::vector<long long> latencies;
+    double operations = 0, syncMicros = 0;
+    for (const BatchStats& batch : stats) {
+      latencies.push_back(batch.latency.count());
+      operations += batch.operations;
+      syncMicros += batch.commitTime.count();
+    }
+
+    // Restart from the log and check nothing was lost
+    TransactionProcessor restarted(logPath, options);
+    bool replayedOk = restarted.ledger().total() == total;
+    for (AccountId id = 0; replayedOk && id < kAccounts; id++) {
+      replayedOk = restarted.ledger().balance(id) == balances[id];
+    }
+    replayedOk = replayedOk &&
+                 total == Money::fromCoins(100) * kAccounts;
+    allGood = allGood && replayedOk;
+
+    cout << std::fixed << std::setprecision(0) << std::setw(10)
+         << config.maxBatch << std::setw(9) << (config.durable ? "yes" : "no")
+         << std::setw(12) << kProducers * kOperationsPerProducer / seconds
+         << std::setprecision(1) << std::setw(11)
+         << operations / stats.size() << std::setw(14)
+         << percentile(latencies, 0.5) << std::setw(14)
+         << percentile(latencies, 0.99) << std::setw(14)
+         << syncMicros / stats.size() << "   replayed " << restarted.replayed()
+         << (replayedOk ? " ok" : " MISMATCH") << endl;
+  }
+  std::remove(logPath.c_str());
+
+  bool detected = corruptionDetected(logPath);
+  cout << "Corrupt record in the middle of the log "
+       << (detected ? "refused, log kept" : "NOT DETECTED") << endl;
+  return allGood && detected ? 0 : 1;
+}
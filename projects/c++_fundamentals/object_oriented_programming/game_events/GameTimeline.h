@@ -0,0 +1,62 @@
+#ifndef GAME_TIMELINE_H
+#define GAME_TIMELINE_H
+
+#include <string>
+#include <vector>
+
+#include "../../profiler/Profiler.h"
+#include "Uuid.h"
+
+using std::string;
+using std::vector;
+
+template <typename T>
+class GameEvent {
+ private:
+  string action;
+  T time;
+  string id;
+
+ public:
+  GameEvent(string action, T time) : action(action), time(time) {
+    id = generate_uuid_v4();
+  }
+  T getTime() { return time; }
+  string getAction() { return action; }
+  bool operator==(const GameEvent* event) { return event->id == this->id; }
+};
+
+template <typename T>
+class GameTimeline {
+ private:
+  vector<GameEvent<T>*> events;
+
+ public:
+  GameTimeline(){};
+
+  void addEvent(GameEvent<T>* event) { events.push_back(event); }
+
+  void removeEvent(GameEvent<T>* event) {
+    for (auto it = events.begin(); it != events.end();) {
+      if (event == *it) {
+        it = events.erase(it);
+      } else {
+        it++;
+      }
+    }
+  }
+
+  vector<GameEvent<T>> getEventsAtTime(T time) {
+    PROFILE_ZONE("GameTimeline::getEventsAtTime");
+    vector<GameEvent<T>> eventsToReturn;
+    for (GameEvent<T>* event : events) {
+      if (event->getTime() == time) {
+        eventsToReturn.push_back(*event);
+      }
+    }
+
+    return eventsToReturn;
+  }
+};
+
+#endif  // GAME_TIMELINE_H
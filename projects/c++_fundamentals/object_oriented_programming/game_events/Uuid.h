@@ -0,0 +1,9 @@
+#ifndef UUID_H
+#define UUID_H
+
+#include <string>
+
+// A random (version 4) UUID such as "1b4e28ba-2fa1-4d2b-883f-0016d3cca427"
+std::string generate_uuid_v4();
+
+#endif  // UUID_H
@@ -0,0 +1,170 @@
+#ifndef CONCURRENT_LINKED_LIST_H
+#define CONCURRENT_LINKED_LIST_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include "../database_management/Epoch.h"
+
+// Lock-free sorted set after Harris, "A Pragmatic Implementation of
+// Non-Blocking Linked-Lists" (2001).
+//
+// remove() first sets the low bit of a node's next pointer (logical
+// deletion), then unlinks it; any thread that walks past a marked node helps
+// unlink it. search() never writes and never waits. Unlinked nodes are
+// reclaimed through an EpochManager. T needs operator< and operator==.
+template <typename T>
+class ConcurrentLinkedList {
+ private:
+  struct ListNode {
+    T data;
+    std::atomic<uintptr_t> next;
+
+    ListNode(const T& data, ListNode* next)
+        : data(data), next(reinterpret_cast<uintptr_t>(next)) {}
+  };
+
+  static bool isMarked(uintptr_t link) { return link & 1; }
+  static uintptr_t marked(uintptr_t link) { return link | 1; }
+  static ListNode* nodeOf(uintptr_t link) {
+    return reinterpret_cast<ListNode*>(link & ~uintptr_t(1));
+  }
+  static uintptr_t linkTo(ListNode* node) {
+    return reinterpret_cast<uintptr_t>(node);
+  }
+
+  // Link to the first node, 0 when empty. Never marked, since there is no
+  // node it belongs to; find() treats it like any node's next.
+  std::atomic<uintptr_t> head;
+  mutable EpochManager epochs;
+
+  // Positions curr on the first node not less than data and prev on the link
+  // that points at it, unlinking marked nodes on the way
+  bool find(const T& data, std::atomic<uintptr_t>*& prev, ListNode*& curr) {
+  retry:
+    prev = &head;
+    curr = nodeOf(prev->load(std::memory_order_acquire));
+    while (curr != nullptr) {
+      uintptr_t succ = curr->next.load(std::memory_order_acquire);
+      if (isMarked(succ)) {
+        uintptr_t expected = linkTo(curr);
+        if (!prev->compare_exchange_strong(expected, succ & ~uintptr_t(1))) {
+          goto retry;
+        }
+        epochs.retire(curr);
+        curr = nodeOf(succ);
+        continue;
+      }
+      if (!(curr->data < data)) {
+        return curr->data == data;
+      }
+      prev = &curr->next;
+      curr = nodeOf(succ);
+    }
+    return false;
+  }
+
+ public:
+  ConcurrentLinkedList() : head(0) {}
+
+  // Only safe once no other thread uses the list
+  ~ConcurrentLinkedList() {
+    ListNode* node = nodeOf(head.load());
+    while (node != nullptr) {
+      ListNode* next = nodeOf(node->next.load());
+      delete node;
+      node = next;
+    }
+  }
+
+  ConcurrentLinkedList(const ConcurrentLinkedList&) = delete;
+  ConcurrentLinkedList& operator=(const ConcurrentLinkedList&) = delete;
+
+  // False when data was already in the list
+  bool add(const T& data) {
+    EpochManager::Guard guard(epochs);
+    ListNode* node = nullptr;
+    while (true) {
+      std::atomic<uintptr_t>* prev;
+      ListNode* curr;
+      if (find(data, prev, curr)) {
+        delete node;
+        return false;
+      }
+      if (node == nullptr) {
+        node = new ListNode(data, curr);
+      } else {
+        node->next.store(linkTo(curr), std::memory_order_relaxed);
+      }
+      uintptr_t expected = linkTo(curr);
+      if (prev->compare_exchange_strong(expected, linkTo(node))) {
+        return true;
+      }
+    }
+  }
+
+  // False when data was not in the list
+  bool remove(const T& data) {
+    EpochManager::Guard guard(epochs);
+    while (true) {
+      std::atomic<uintptr_t>* prev;
+      ListNode* curr;
+      if (!find(data, prev, curr)) {
+        return false;
+      }
+      uintptr_t succ = curr->next.load(std::memory_order_acquire);
+      if (isMarked(succ)) {
+        continue;
+      }
+      if (!curr->next.compare_exchange_strong(succ, marked(succ))) {
+        continue;
+      }
+      // Logically gone; unlink now or leave it to the next find()
+      uintptr_t expected = linkTo(curr);
+      if (prev->compare_exchange_strong(expected, succ)) {
+        epochs.retire(curr);
+      } else {
+        find(data, prev, curr);
+      }
+      return true;
+    }
+  }
+
+  bool search(const T& data) const {
+    EpochManager::Guard guard(epochs);
+    ListNode* curr = nodeOf(head.load(std::memory_order_acquire));
+    while (curr != nullptr && curr->data < data) {
+      curr = nodeOf(curr->next.load(std::memory_order_acquire));
+    }
+    return curr != nullptr && curr->data == data &&
+           !isMarked(curr->next.load(std::memory_order_acquire));
+  }
+
+  // Elements not marked for deletion, in ascending order. Consistent only
+  // while no other thread is writing.
+  std::vector<T> toVector() const {
+    EpochManager::Guard guard(epochs);
+    std::vector<T> elements;
+    ListNode* curr = nodeOf(head.load(std::memory_order_acquire));
+    while (curr != nullptr) {
+      uintptr_t next = curr->next.load(std::memory_order_acquire);
+      if (!isMarked(next)) {
+        elements.push_back(curr->data);
+      }
+      curr = nodeOf(next);
+    }
+    return elements;
+  }
+
+  void printList() const {
+    for (const T& data : toVector()) {
+      std::cout << data << " ";
+    }
+    std::cout << "\n";
+  }
+};
+
+#endif  // CONCURRENT_LINKED_LIST_H
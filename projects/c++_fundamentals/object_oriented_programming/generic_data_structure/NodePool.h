@@ -0,0 +1,69 @@
+#ifndef NODE_POOL_H
+#define NODE_POOL_H
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+// Hands out uninitialized memory for objects of type T, carved from large
+// slabs so neighbouring nodes end up next to each other in memory. Freed
+// slots are kept on an intrusive free list and reused; slabs are returned
+// only when the pool is destroyed.
+template <typename T>
+class NodePool {
+ private:
+  union Slot {
+    Slot* nextFree;
+    alignas(T) unsigned char storage[sizeof(T)];
+  };
+
+  std::vector<Slot*> slabs;
+  Slot* freeList;
+  std::size_t slabSize;
+
+  void addSlab() {
+    Slot* slab = static_cast<Slot*>(::operator new(
+        slabSize * sizeof(Slot), std::align_val_t(alignof(Slot))));
+    slabs.push_back(slab);
+    // Thread the new slots in address order so allocation walks forward
+    for (std::size_t i = slabSize; i > 0; i--) {
+      slab[i - 1].nextFree = freeList;
+      freeList = &slab[i - 1];
+    }
+    if (slabSize < kMaxSlabSize) {
+      slabSize *= 2;
+    }
+  }
+
+ public:
+  static const std::size_t kFirstSlabSize = 64;
+  static const std::size_t kMaxSlabSize = 1 << 16;
+
+  NodePool() : freeList(nullptr), slabSize(kFirstSlabSize) {}
+
+  ~NodePool() {
+    for (Slot* slab : slabs) {
+      ::operator delete(slab, std::align_val_t(alignof(Slot)));
+    }
+  }
+
+  NodePool(const NodePool&) = delete;
+  NodePool& operator=(const NodePool&) = delete;
+
+  void* allocate() {
+    if (freeList == nullptr) {
+      addSlab();
+    }
+    Slot* slot = freeList;
+    freeList = slot->nextFree;
+    return slot->storage;
+  }
+
+  void deallocate(void* pointer) {
+    Slot* slot = static_cast<Slot*>(pointer);
+    slot->nextFree = freeList;
+    freeList = slot;
+  }
+};
+
+#endif  // NODE_POOL_H
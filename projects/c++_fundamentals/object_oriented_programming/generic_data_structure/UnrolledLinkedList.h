@@ -0,0 +1,204 @@
+#ifndef UNROLLED_LINKED_LIST_H
+#define UNROLLED_LINKED_LIST_H
+
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <new>
+#include <utility>
+
+#include "LinkedList.h"
+#include "NodePool.h"
+
+// Linked list whose nodes each hold several elements and fill one cache line
+// (NodeBytes), so walking it touches far fewer nodes than LinkedList. Nodes
+// come from a NodePool. Same interface as LinkedList: add() and remove()
+// work on the front of the list and search() scans it.
+template <typename T, std::size_t NodeBytes = 64>
+class UnrolledLinkedList {
+ private:
+  struct Header {
+    void* next;
+    unsigned count;
+  };
+
+ public:
+  static const std::size_t kNodeCapacity =
+      NodeBytes > sizeof(Header) + sizeof(T)
+          ? (NodeBytes - sizeof(Header)) / sizeof(T)
+          : 1;
+
+ private:
+  // The newest element of a node sits at the highest index, so adding to
+  // the front of the list only ever appends inside the head node
+  struct alignas(NodeBytes >= alignof(T) ? NodeBytes : alignof(T)) ListNode {
+    ListNode* next;
+    unsigned count;
+    alignas(T) unsigned char storage[kNodeCapacity * sizeof(T)];
+
+    T* items() { return reinterpret_cast<T*>(storage); }
+  };
+
+  ListNode* head;
+  std::size_t length;
+  NodePool<ListNode> pool;
+
+  ListNode* newHead() {
+    ListNode* node = new (pool.allocate()) ListNode;
+    node->next = head;
+    node->count = 0;
+    head = node;
+    return node;
+  }
+
+  void freeHead() {
+    ListNode* node = head;
+    head = node->next;
+    node->~ListNode();
+    pool.deallocate(node);
+  }
+
+  // After a copy into node threw: a head it was going to start stays out
+  void abandon(ListNode* node) {
+    if (node->count == 0) {
+      freeHead();
+    }
+  }
+
+ public:
+  template <typename Value>
+  class Iterator {
+   private:
+    ListNode* node;
+    unsigned index;  // One past the element, counting down within the node
+
+    friend class UnrolledLinkedList;
+    Iterator(ListNode* node) : node(node), index(node ? node->count : 0) {}
+
+   public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef Value value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef Value* pointer;
+    typedef Value& reference;
+
+    Iterator() : node(nullptr), index(0) {}
+
+    Value& operator*() const { return node->items()[index - 1]; }
+    Value* operator->() const { return &node->items()[index - 1]; }
+
+    Iterator& operator++() {
+      if (--index == 0) {
+        node = node->next;
+        index = node ? node->count : 0;
+      }
+      return *this;
+    }
+
+    Iterator operator++(int) {
+      Iterator previous = *this;
+      ++*this;
+      return previous;
+    }
+
+    bool operator==(const Iterator& other) const {
+      return node == other.node && index == other.index;
+    }
+    bool operator!=(const Iterator& other) const { return !(*this == other); }
+  };
+
+  typedef Iterator<T> iterator;
+  typedef Iterator<const T> const_iterator;
+
+  UnrolledLinkedList() : head(nullptr), length(0) {}
+
+  ~UnrolledLinkedList() {
+    while (head != nullptr) {
+      for (unsigned i = 0; i < head->count; i++) {
+        head->items()[i].~T();
+      }
+      freeHead();
+    }
+  }
+
+  UnrolledLinkedList(const UnrolledLinkedList&) = delete;
+  UnrolledLinkedList& operator=(const UnrolledLinkedList&) = delete;
+
+  void add(const T& data) {
+    ListNode* node = head;
+    if (node == nullptr || node->count == kNodeCapacity) {
+      node = newHead();
+    }
+    try {
+      new (node->items() + node->count) T(data);
+    } catch (...) {
+      abandon(node);
+      throw;
+    }
+    node->count++;
+    length++;
+  }
+
+  // Same result as calling add() on each element in order: the last one
+  // ends up at the front. If a copy throws, the elements before it stay.
+  template <typename InputIt>
+  void add(InputIt first, InputIt last) {
+    while (first != last) {
+      ListNode* node = head;
+      if (node == nullptr || node->count == kNodeCapacity) {
+        node = newHead();
+      }
+      T* items = node->items();
+      try {
+        for (; node->count < kNodeCapacity && first != last; ++first) {
+          new (items + node->count) T(*first);
+          node->count++;
+          length++;
+        }
+      } catch (...) {
+        abandon(node);
+        throw;
+      }
+    }
+  }
+
+  void remove() {
+    if (head == nullptr) {
+      throw EmptyListException();
+    }
+    head->items()[--head->count].~T();
+    length--;
+    if (head->count == 0) {
+      freeHead();
+    }
+  }
+
+  bool search(const T& data) const {
+    for (ListNode* node = head; node != nullptr; node = node->next) {
+      const T* items = node->items();
+      for (unsigned i = 0; i < node->count; i++) {
+        if (items[i] == data) {
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+
+  void printList() const {
+    for (const T& data : *this) {
+      std::cout << data << " ";
+    }
+    std::cout << "\n";
+  }
+
+  std::size_t size() const { return length; }
+  bool empty() const { return length == 0; }
+
+  iterator begin() { return iterator(head); }
+  iterator end() { return iterator(nullptr); }
+  const_iterator begin() const { return const_iterator(head); }
+  const_iterator end() const { return const_iterator(nullptr); }
+};
+
+#endif  // UNROLLED_LINKED_LIST_H
@@ -0,0 +1,100 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "LinkedList.h"
+#include "UnrolledLinkedList.h"
+
+using std::cout;
+using std::endl;
+
+template <typename Function>
+double millisecondsFor(Function function) {
+  auto begin = std::chrono::steady_clock::now();
+  function();
+  return std::chrono::duration<double, std::milli>(
+             std::chrono::steady_clock::now() - begin)
+      .count();
+}
+
+void printRow(const std::string& name, double insertMs, double searchMs) {
+  cout << std::setw(24) << name << std::setw(14) << insertMs << std::setw(14)
+       << searchMs << endl;
+}
+
+// search() for a value that is not there walks the whole container
+void benchmark(long count) {
+  const int missing = -1;
+  std::vector<int> values(count);
+  std::iota(values.begin(), values.end(), 0);
+
+  cout << endl << count << " elements" << endl;
+  cout << std::setw(24) << "container" << std::setw(14) << "insert ms"
+       << std::setw(14) << "search ms" << endl;
+
+  bool found = false;
+  {
+    LinkedList<int> list;
+    double insertMs = millisecondsFor([&]() {
+      for (int value : values) {
+        list.add(value);
+      }
+    });
+    double searchMs = millisecondsFor([&]() { found |= list.search(missing); });
+    printRow("LinkedList", insertMs, searchMs);
+  }
+  {
+    UnrolledLinkedList<int> list;
+    double insertMs = millisecondsFor([&]() {
+      for (int value : values) {
+        list.add(value);
+      }
+    });
+    double searchMs = millisecondsFor([&]() { found |= list.search(missing); });
+    printRow("UnrolledLinkedList", insertMs, searchMs);
+  }
+  {
+    UnrolledLinkedList<int> list;
+    double insertMs =
+        millisecondsFor([&]() { list.add(values.begin(), values.end()); });
+    double searchMs = millisecondsFor([&]() {
+      found |= std::find(list.begin(), list.end(), missing) != list.end();
+    });
+    printRow("Unrolled bulk/iterator", insertMs, searchMs);
+  }
+  {
+    std::vector<int> vector;
+    double insertMs = millisecondsFor([&]() {
+      for (int value : values) {
+        vector.push_back(value);
+      }
+    });
+    double searchMs = millisecondsFor([&]() {
+      found |= std::find(vector.begin(), vector.end(), missing) != vector.end();
+    });
+    printRow("std::vector", insertMs, searchMs);
+  }
+
+  if (found) {
+    cout << "Unexpected match" << endl;
+  }
+}
+
+// Usage: benchmark [largest size], defaults to 10^7. Passing 100000000 adds
+// the 10^8 run, which needs several GB for LinkedList alone.
+int main(int argc, char* argv[]) {
+  long largest = argc > 1 ? std::atol(argv[1]) : 10000000;
+  cout << std::fixed << std::setprecision(2);
+  cout << "Node capacity of UnrolledLinkedList<int>: "
+       << UnrolledLinkedList<int>::kNodeCapacity << endl;
+
+  for (long count = 1000000; count <= largest; count *= 10) {
+    benchmark(count);
+  }
+  return 0;
+}
@@ -0,0 +1,164 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "ConcurrentLinkedList.h"
+
+using std::cout;
+using std::endl;
+
+const int kKeyRange = 1024;
+const int kStressOperations = 200000;
+const std::chrono::milliseconds kRunTime(300);
+
+template <typename Worker>
+void runThreads(int threads, Worker worker) {
+  std::vector<std::thread> pool;
+  for (int t = 0; t < threads; t++) {
+    pool.emplace_back(worker, t);
+  }
+  for (std::thread& thread : pool) {
+    thread.join();
+  }
+}
+
+// Threads hammer a small shared key range with random add/remove/search.
+// Afterwards the list must be sorted, free of duplicates, and hold exactly
+// as many keys as successful adds minus successful removes. Keys k with
+// k % threads == t are also owned by thread t, which tracks them precisely.
+void stressTest(int threads) {
+  ConcurrentLinkedList<int> list;
+  std::atomic<long> netAdds(0);
+  std::vector<std::vector<char>> owned(threads,
+                                       std::vector<char>(kKeyRange * 2, 0));
+
+  runThreads(threads, [&](int t) {
+    std::mt19937 gen(99 + t);
+    std::uniform_int_distribution<int> sharedKey(0, 63);
+    std::uniform_int_distribution<int> ownKey(0, kKeyRange / threads);
+    std::uniform_int_distribution<int> pickOp(0, 2);
+    long net = 0;
+    for (int i = 0; i < kStressOperations; i++) {
+      // Shared keys live below 64, owned keys from kKeyRange upwards
+      bool shared = i % 2 == 0;
+      int key = shared ? sharedKey(gen)
+                       : kKeyRange + ownKey(gen) * threads + t;
+      int op = pickOp(gen);
+      if (op == 0) {
+        if (list.add(key)) {
+          net++;
+          if (!shared) {
+            owned[t][key - kKeyRange] = 1;
+          }
+        } else if (!shared && !owned[t][key - kKeyRange]) {
+          throw std::runtime_error("add() failed for an owned key");
+        }
+      } else if (op == 1) {
+        if (list.remove(key)) {
+          net--;
+          if (!shared) {
+            owned[t][key - kKeyRange] = 0;
+          }
+        } else if (!shared && owned[t][key - kKeyRange]) {
+          throw std::runtime_error("remove() missed an owned key");
+        }
+      } else if (!shared && list.search(key) != bool(owned[t][key - kKeyRange])) {
+        throw std::runtime_error("search() disagrees for an owned key");
+      }
+    }
+    netAdds.fetch_add(net);
+  });
+
+  std::vector<int> contents = list.toVector();
+  if (!std::is_sorted(contents.begin(), contents.end()) ||
+      std::adjacent_find(contents.begin(), contents.end()) != contents.end()) {
+    throw std::runtime_error("List is unsorted or has duplicates");
+  }
+  if (static_cast<long>(contents.size()) != netAdds.load()) {
+    throw std::runtime_error("List size does not match adds minus removes");
+  }
+  for (int t = 0; t < threads; t++) {
+    for (int i = 0; i < kKeyRange * 2; i++) {
+      bool present = std::binary_search(contents.begin(), contents.end(),
+                                        kKeyRange + i);
+      if (i % threads == t && present != bool(owned[t][i])) {
+        throw std::runtime_error("Owned key in the wrong state");
+      }
+    }
+  }
+  cout << "Stress test with " << threads << " threads passed ("
+       << contents.size() << " keys left)" << endl;
+}
+
+double throughput(int threads, int readPercent) {
+  ConcurrentLinkedList<int> list;
+  for (int key = 0; key < kKeyRange; key += 2) {
+    list.add(key);
+  }
+
+  std::atomic<bool> stop(false);
+  std::atomic<long> operations(0);
+  std::thread timer([&]() {
+    std::this_thread::sleep_for(kRunTime);
+    stop.store(true);
+  });
+  runThreads(threads, [&](int t) {
+    std::mt19937 gen(7 + t);
+    std::uniform_int_distribution<int> pickKey(0, kKeyRange - 1);
+    std::uniform_int_distribution<int> pickOp(0, 99);
+    long done = 0;
+    while (!stop.load(std::memory_order_relaxed)) {
+      int key = pickKey(gen);
+      int op = pickOp(gen);
+      if (op < readPercent) {
+        list.search(key);
+      } else if (op % 2 == 0) {
+        list.add(key);
+      } else {
+        list.remove(key);
+      }
+      done++;
+    }
+    operations.fetch_add(done);
+  });
+  timer.join();
+  return operations.load() / (kRunTime.count() / 1000.0) / 1e6;
+}
+
+// Usage: concurrentBenchmark [max threads]
+int main(int argc, char* argv[]) {
+  int maxThreads = argc > 1 ? std::atoi(argv[1])
+                            : std::thread::hardware_concurrency();
+  maxThreads = std::max(2, maxThreads);
+
+  std::vector<int> threadCounts;
+  for (int t = 1; t < maxThreads; t *= 2) {
+    threadCounts.push_back(t);
+  }
+  threadCounts.push_back(maxThreads);
+
+  for (int threads : threadCounts) {
+    stressTest(threads);
+  }
+
+  cout << endl
+       << "Throughput over " << kKeyRange << " keys, Mops/s" << endl;
+  cout << std::setw(8) << "threads" << std::setw(12) << "100% read"
+       << std::setw(12) << "90% read" << std::setw(12) << "50% read" << endl;
+  cout << std::fixed << std::setprecision(2);
+  for (int threads : threadCounts) {
+    cout << std::setw(8) << threads;
+    for (int readPercent : {100, 90, 50}) {
+      cout << std::setw(12) << throughput(threads, readPercent);
+    }
+    cout << endl;
+  }
+  return 0;
+}
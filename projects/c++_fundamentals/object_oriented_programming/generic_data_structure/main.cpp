@@ -1,72 +1,7 @@
-#include <exception>
 #include <iostream>
 
-template <typename T>
-class Node {
- public:
-  T data;
-  Node<T>* next;
-  Node(const T& data) : data(data), next(nullptr) {}
-};
-
-// Exception class for empty list
-class EmptyListException : public std::exception {
- public:
-  const char* what() const throw() { return "List is empty!"; }
-};
-
-// LinkedList class
-template <typename T>
-class LinkedList {
- private:
-  Node<T>* head;
-
- public:
-  LinkedList() : head(nullptr) {}
-
-  ~LinkedList() {
-    while (head != nullptr) {
-      Node<T>* temp = head;
-      head = head->next;
-      delete temp;
-    }
-  }
-
-  void add(const T& data) {
-    Node<T>* newNode = new Node<T>(data);
-    newNode->next = head;
-    head = newNode;
-  }
-
-  void remove() {
-    if (head == nullptr) {
-      throw EmptyListException();
-    }
-    Node<T>* temp = head;
-    head = head->next;
-    delete temp;
-  }
-
-  bool search(const T& data) {
-    Node<T>* current = head;
-    while (current != nullptr) {
-      if (current->data == data) {
-        return true;
-      }
-      current = current->next;
-    }
-    return false;
-  }
-
-  void printList() {
-    Node<T>* current = head;
-    while (current != nullptr) {
-      std::cout << current->data << " ";
-      current = current->next;
-    }
-    std::cout << "\n";
-  }
-};
+#include "LinkedList.h"
+#include "UnrolledLinkedList.h"
 
 int main() {
   LinkedList<int> list;
@@ -84,5 +19,19 @@ int main() {
   } catch (EmptyListException& e) {
     std::cerr << "Exception: " << e.what() << "\n";
   }
+
+  UnrolledLinkedList<int> unrolled;
+  int values[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+  unrolled.add(std::begin(values), std::end(values));
+  unrolled.add(16);
+  unrolled.printList();
+  unrolled.remove();
+
+  int sum = 0;
+  for (int value : unrolled) {
+    sum += value;
+  }
+  std::cout << "Sum: " << sum << "\n";
+  std::cout << (unrolled.search(13) ? "Found\n" : "Not Found\n");
   return 0;
 }
\ No newline at end of file
@@ -0,0 +1,131 @@
+#ifndef FIXED_POINT_H
+#define FIXED_POINT_H
+
+#include <cstdint>
+#include <stdexcept>
+
+#include "Point.h"
+
+// 16.16 signed fixed-point number for lockstep simulation.
+//
+// Every operation is defined purely in integer arithmetic, so results are
+// bit-identical on every platform and compiler. Overflow wraps (computed on
+// unsigned values, never signed overflow), and products and quotients round
+// toward negative infinity.
+class Fixed {
+ private:
+  int32_t raw;
+
+  static int32_t wrap(uint32_t bits) { return static_cast<int32_t>(bits); }
+
+  // Floor division by 2^16 that does not depend on how >> treats negatives
+  static int32_t floorShift(int64_t value) {
+    int64_t quotient = value / 65536;
+    if (value % 65536 < 0) {
+      quotient--;
+    }
+    return wrap(static_cast<uint32_t>(static_cast<uint64_t>(quotient)));
+  }
+
+ public:
+  static const int kFractionBits = 16;
+  static const int32_t kOne = 1 << kFractionBits;
+
+  Fixed() : raw(0) {}
+
+  static Fixed fromInt(int32_t value) {
+    return fromRaw(wrap(static_cast<uint32_t>(value) << kFractionBits));
+  }
+
+  // numerator / denominator, e.g. fromRatio(1, 3) for a third
+  static Fixed fromRatio(int32_t numerator, int32_t denominator) {
+    return fromInt(numerator) / fromInt(denominator);
+  }
+
+  static Fixed fromRaw(int32_t raw) {
+    Fixed value;
+    value.raw = raw;
+    return value;
+  }
+
+  int32_t rawValue() const { return raw; }
+
+  // Rounds toward negative infinity
+  int32_t toInt() const { return floorShift(int64_t(raw)); }
+
+  // For display only; never feed this back into the simulation
+  double toDouble() const { return raw / 65536.0; }
+
+  Fixed operator+(Fixed rhs) const {
+    return fromRaw(wrap(uint32_t(raw) + uint32_t(rhs.raw)));
+  }
+  Fixed operator-(Fixed rhs) const {
+    return fromRaw(wrap(uint32_t(raw) - uint32_t(rhs.raw)));
+  }
+  Fixed operator-() const { return fromRaw(wrap(0u - uint32_t(raw))); }
+  Fixed operator*(Fixed rhs) const {
+    return fromRaw(floorShift(int64_t(raw) * rhs.raw));
+  }
+
+  Fixed operator/(Fixed rhs) const {
+    if (rhs.raw == 0) {
+      throw std::domain_error("Fixed-point division by zero");
+    }
+    int64_t numerator = int64_t(raw) * 65536;
+    int64_t quotient = numerator / rhs.raw;
+    if ((numerator % rhs.raw != 0) && ((numerator < 0) != (rhs.raw < 0))) {
+      quotient--;
+    }
+    return fromRaw(
+        wrap(static_cast<uint32_t>(static_cast<uint64_t>(quotient))));
+  }
+
+  Fixed& operator+=(Fixed rhs) { return *this = *this + rhs; }
+  Fixed& operator-=(Fixed rhs) { return *this = *this - rhs; }
+  Fixed& operator*=(Fixed rhs) { return *this = *this * rhs; }
+
+  bool operator==(Fixed rhs) const { return raw == rhs.raw; }
+  bool operator!=(Fixed rhs) const { return raw != rhs.raw; }
+  bool operator<(Fixed rhs) const { return raw < rhs.raw; }
+  bool operator<=(Fixed rhs) const { return raw <= rhs.raw; }
+  bool operator>(Fixed rhs) const { return raw > rhs.raw; }
+  bool operator>=(Fixed rhs) const { return raw >= rhs.raw; }
+};
+
+class FixedVec3 {
+ public:
+  Fixed x, y, z;
+
+  FixedVec3() {}
+  FixedVec3(Fixed x, Fixed y, Fixed z) : x(x), y(y), z(z) {}
+
+  // Grid point to its fixed-point position
+  explicit FixedVec3(const Point3D& point)
+      : x(Fixed::fromInt(point.x)),
+        y(Fixed::fromInt(point.y)),
+        z(Fixed::fromInt(point.z)) {}
+
+  FixedVec3 operator+(const FixedVec3& rhs) const {
+    return FixedVec3(x + rhs.x, y + rhs.y, z + rhs.z);
+  }
+  FixedVec3 operator-(const FixedVec3& rhs) const {
+    return FixedVec3(x - rhs.x, y - rhs.y, z - rhs.z);
+  }
+  FixedVec3 operator*(Fixed scale) const {
+    return FixedVec3(x * scale, y * scale, z * scale);
+  }
+
+  bool operator==(const FixedVec3& rhs) const {
+    return x == rhs.x && y == rhs.y && z == rhs.z;
+  }
+  bool operator!=(const FixedVec3& rhs) const { return !(*this == rhs); }
+
+  Fixed dot(const FixedVec3& rhs) const {
+    return x * rhs.x + y * rhs.y + z * rhs.z;
+  }
+
+  // Grid cell containing this position
+  Point3D toPoint() const { return Point3D(x.toInt(), y.toInt(), z.toInt()); }
+};
+
+#endif  // FIXED_POINT_H
@@ -0,0 +1,88 @@
+#ifndef POINT_H
+#define POINT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+class Point {
+ public:
+  int x, y;
+
+  Point(int x = 0, int y = 0) : x(x), y(y) {}
+
+  Point operator+(const Point& point) const {
+    return Point(x + point.x, y + point.y);
+  }
+
+  Point operator-(const Point& point) const {
+    return Point(x - point.x, y - point.y);
+  }
+
+  bool operator==(const Point& point) const {
+    return x == point.x && y == point.y;
+  }
+
+  bool operator!=(const Point& point) const { return !(*this == point); }
+};
+
+class Point3D : public Point {
+ public:
+  int z;
+
+  Point3D(int x = 0, int y = 0, int z = 0) : Point(x, y), z(z) {}
+
+  Point3D operator+(const Point3D& point) const {
+    return Point3D(x + point.x, y + point.y, z + point.z);
+  }
+
+  Point3D operator-(const Point3D& point) const {
+    return Point3D(x - point.x, y - point.y, z - point.z);
+  }
+
+  bool operator==(const Point3D& point) const {
+    return x == point.x && y == point.y && z == point.z;
+  }
+
+  bool operator!=(const Point3D& point) const { return !(*this == point); }
+};
+
+// Finalizer from MurmurHash3: every input bit affects every output bit, so
+// neighbouring grid points land in unrelated buckets
+inline uint64_t mixPointBits(uint64_t bits) {
+  bits ^= bits >> 33;
+  bits *= 0xff51afd7ed558ccdULL;
+  bits ^= bits >> 33;
+  bits *= 0xc4ceb9fe1a85ec53ULL;
+  bits ^= bits >> 33;
+  return bits;
+}
+
+inline uint64_t hashPoint(const Point& point) {
+  return mixPointBits(uint64_t(uint32_t(point.x)) << 32 | uint32_t(point.y));
+}
+
+inline uint64_t hashPoint(const Point3D& point) {
+  uint64_t xy = uint64_t(uint32_t(point.x)) << 32 | uint32_t(point.y);
+  return mixPointBits(mixPointBits(xy) ^ uint32_t(point.z));
+}
+
+namespace std {
+
+template <>
+struct hash<Point> {
+  size_t operator()(const Point& point) const {
+    return static_cast<size_t>(hashPoint(point));
+  }
+};
+
+template <>
+struct hash<Point3D> {
+  size_t operator()(const Point3D& point) const {
+    return static_cast<size_t>(hashPoint(point));
+  }
+};
+
+}  // namespace std
+
+#endif  // POINT_H
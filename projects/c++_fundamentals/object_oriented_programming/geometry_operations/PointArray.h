@@ -0,0 +1,315 @@
+#ifndef POINT_ARRAY_H
+#define POINT_ARRAY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#include "FixedPoint.h"
+#include "Point.h"
+
+// Packed int32 lanes. Integer SIMD is exact, so every path (AVX2, SSE2,
+// scalar) produces the same bits; overflow wraps in all three.
+struct IntPack {
+#if defined(__AVX2__)
+  static const size_t width = 8;
+  __m256i v;
+
+  static IntPack load(const int32_t* p) {
+    return {_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p))};
+  }
+  static IntPack broadcast(int32_t s) { return {_mm256_set1_epi32(s)}; }
+  void store(int32_t* p) const {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v);
+  }
+  IntPack operator+(IntPack o) const { return {_mm256_add_epi32(v, o.v)}; }
+  IntPack operator-(IntPack o) const { return {_mm256_sub_epi32(v, o.v)}; }
+  IntPack operator&(IntPack o) const { return {_mm256_and_si256(v, o.v)}; }
+  IntPack min(IntPack o) const { return {_mm256_min_epi32(v, o.v)}; }
+  IntPack max(IntPack o) const { return {_mm256_max_epi32(v, o.v)}; }
+  // All ones in each lane where the values match
+  IntPack equal(IntPack o) const { return {_mm256_cmpeq_epi32(v, o.v)}; }
+  // One bit per lane, lane 0 in bit 0
+  int laneMask() const { return _mm256_movemask_ps(_mm256_castsi256_ps(v)); }
+#elif defined(__SSE2__)
+  static const size_t width = 4;
+  __m128i v;
+
+  static IntPack load(const int32_t* p) {
+    return {_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))};
+  }
+  static IntPack broadcast(int32_t s) { return {_mm_set1_epi32(s)}; }
+  void store(int32_t* p) const {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v);
+  }
+  IntPack operator+(IntPack o) const { return {_mm_add_epi32(v, o.v)}; }
+  IntPack operator-(IntPack o) const { return {_mm_sub_epi32(v, o.v)}; }
+  IntPack operator&(IntPack o) const { return {_mm_and_si128(v, o.v)}; }
+#if defined(__SSE4_1__)
+  IntPack min(IntPack o) const { return {_mm_min_epi32(v, o.v)}; }
+  IntPack max(IntPack o) const { return {_mm_max_epi32(v, o.v)}; }
+#else
+  // SSE2 has no 32-bit min/max; select through a compare mask instead
+  IntPack min(IntPack o) const {
+    __m128i greater = _mm_cmpgt_epi32(v, o.v);
+    return {_mm_or_si128(_mm_and_si128(greater, o.v),
+                         _mm_andnot_si128(greater, v))};
+  }
+  IntPack max(IntPack o) const {
+    __m128i greater = _mm_cmpgt_epi32(v, o.v);
+    return {_mm_or_si128(_mm_and_si128(greater, v),
+                         _mm_andnot_si128(greater, o.v))};
+  }
+#endif
+  IntPack equal(IntPack o) const { return {_mm_cmpeq_epi32(v, o.v)}; }
+  int laneMask() const { return _mm_movemask_ps(_mm_castsi128_ps(v)); }
+#else
+  static const size_t width = 1;
+  int32_t v;
+
+  static IntPack load(const int32_t* p) { return {*p}; }
+  static IntPack broadcast(int32_t s) { return {s}; }
+  void store(int32_t* p) const { *p = v; }
+  IntPack operator+(IntPack o) const {
+    return {static_cast<int32_t>(uint32_t(v) + uint32_t(o.v))};
+  }
+  IntPack operator-(IntPack o) const {
+    return {static_cast<int32_t>(uint32_t(v) - uint32_t(o.v))};
+  }
+  IntPack operator&(IntPack o) const { return {v & o.v}; }
+  IntPack min(IntPack o) const { return {o.v < v ? o.v : v}; }
+  IntPack max(IntPack o) const { return {o.v > v ? o.v : v}; }
+  IntPack equal(IntPack o) const { return {v == o.v ? -1 : 0}; }
+  int laneMask() const { return v != 0 ? 1 : 0; }
+#endif
+};
+
+inline int32_t wrappingAdd(int32_t a, int32_t b) {
+  return static_cast<int32_t>(uint32_t(a) + uint32_t(b));
+}
+
+inline int32_t wrappingSub(int32_t a, int32_t b) {
+  return static_cast<int32_t>(uint32_t(a) - uint32_t(b));
+}
+
+// Point set stored as three int32 lanes (structure of arrays) so the kernels
+// below can load IntPack::width coordinates of one axis at a time. A set of
+// 16.16 positions is stored as raw Fixed values; add, sub, compare and
+// bounds work on them unchanged.
+class PointArray {
+ private:
+  std::vector<int32_t> xs, ys, zs;
+
+ public:
+  PointArray() {}
+  explicit PointArray(size_t count) : xs(count), ys(count), zs(count) {}
+
+  size_t size() const { return xs.size(); }
+  bool empty() const { return xs.empty(); }
+
+  void reserve(size_t count) {
+    xs.reserve(count);
+    ys.reserve(count);
+    zs.reserve(count);
+  }
+
+  void push_back(const Point3D& point) {
+    xs.push_back(point.x);
+    ys.push_back(point.y);
+    zs.push_back(point.z);
+  }
+
+  void push_back(const FixedVec3& position) {
+    xs.push_back(position.x.rawValue());
+    ys.push_back(position.y.rawValue());
+    zs.push_back(position.z.rawValue());
+  }
+
+  Point3D operator[](size_t i) const { return Point3D(xs[i], ys[i], zs[i]); }
+
+  FixedVec3 fixedAt(size_t i) const {
+    return FixedVec3(Fixed::fromRaw(xs[i]), Fixed::fromRaw(ys[i]),
+                     Fixed::fromRaw(zs[i]));
+  }
+
+  void set(size_t i, const Point3D& point) {
+    xs[i] = point.x;
+    ys[i] = point.y;
+    zs[i] = point.z;
+  }
+
+  int32_t* x() { return xs.data(); }
+  int32_t* y() { return ys.data(); }
+  int32_t* z() { return zs.data(); }
+  const int32_t* x() const { return xs.data(); }
+  const int32_t* y() const { return ys.data(); }
+  const int32_t* z() const { return zs.data(); }
+};
+
+class BoundingBox {
+ public:
+  Point3D min, max;
+
+  BoundingBox() {}
+  BoundingBox(const Point3D& min, const Point3D& max) : min(min), max(max) {}
+
+  bool contains(const Point3D& point) const {
+    return point.x >= min.x && point.x <= max.x && point.y >= min.y &&
+           point.y <= max.y && point.z >= min.z && point.z <= max.z;
+  }
+};
+
+namespace point_kernels {
+
+inline void lanewise(const int32_t* a, const int32_t* b, int32_t* out,
+                     size_t count, bool subtract) {
+  size_t i = 0;
+  for (; i + IntPack::width <= count; i += IntPack::width) {
+    IntPack lhs = IntPack::load(a + i);
+    IntPack rhs = IntPack::load(b + i);
+    (subtract ? lhs - rhs : lhs + rhs).store(out + i);
+  }
+  for (; i < count; i++) {
+    out[i] = subtract ? wrappingSub(a[i], b[i]) : wrappingAdd(a[i], b[i]);
+  }
+}
+
+inline void requireSameSize(const PointArray& a, const PointArray& b) {
+  if (a.size() != b.size()) {
+    throw std::invalid_argument("Point arrays must have the same size");
+  }
+}
+
+}  // namespace point_kernels
+
+// out[i] = a[i] + b[i]; out may alias a or b
+inline void addPoints(const PointArray& a, const PointArray& b,
+                      PointArray& out) {
+  point_kernels::requireSameSize(a, b);
+  if (out.size() != a.size()) {
+    out = PointArray(a.size());
+  }
+  point_kernels::lanewise(a.x(), b.x(), out.x(), a.size(), false);
+  point_kernels::lanewise(a.y(), b.y(), out.y(), a.size(), false);
+  point_kernels::lanewise(a.z(), b.z(), out.z(), a.size(), false);
+}
+
+// out[i] = a[i] - b[i]; out may alias a or b
+inline void subPoints(const PointArray& a, const PointArray& b,
+                      PointArray& out) {
+  point_kernels::requireSameSize(a, b);
+  if (out.size() != a.size()) {
+    out = PointArray(a.size());
+  }
+  point_kernels::lanewise(a.x(), b.x(), out.x(), a.size(), true);
+  point_kernels::lanewise(a.y(), b.y(), out.y(), a.size(), true);
+  point_kernels::lanewise(a.z(), b.z(), out.z(), a.size(), true);
+}
+
+// points[i] += offset
+inline void translate(PointArray& points, const Point3D& offset) {
+  const int32_t deltas[3] = {offset.x, offset.y, offset.z};
+  int32_t* lanes[3] = {points.x(), points.y(), points.z()};
+  size_t count = points.size();
+  for (int axis = 0; axis < 3; axis++) {
+    int32_t* lane = lanes[axis];
+    IntPack delta = IntPack::broadcast(deltas[axis]);
+    size_t i = 0;
+    for (; i + IntPack::width <= count; i += IntPack::width) {
+      (IntPack::load(lane + i) + delta).store(lane + i);
+    }
+    for (; i < count; i++) {
+      lane[i] = wrappingAdd(lane[i], deltas[axis]);
+    }
+  }
+}
+
+// positions[i] += offset for a set of 16.16 positions
+inline void translate(PointArray& positions, const FixedVec3& offset) {
+  translate(positions, Point3D(offset.x.rawValue(), offset.y.rawValue(),
+                               offset.z.rawValue()));
+}
+
+// Writes 1 to matches[i] where a[i] == b[i], 0 otherwise; returns the count
+inline size_t comparePoints(const PointArray& a, const PointArray& b,
+                            std::vector<uint8_t>& matches) {
+  point_kernels::requireSameSize(a, b);
+  size_t count = a.size();
+  matches.resize(count);
+  size_t equalCount = 0;
+  size_t i = 0;
+  for (; i + IntPack::width <= count; i += IntPack::width) {
+    IntPack same = IntPack::load(a.x() + i).equal(IntPack::load(b.x() + i)) &
+                   IntPack::load(a.y() + i).equal(IntPack::load(b.y() + i)) &
+                   IntPack::load(a.z() + i).equal(IntPack::load(b.z() + i));
+    int mask = same.laneMask();
+    for (size_t lane = 0; lane < IntPack::width; lane++) {
+      uint8_t bit = (mask >> lane) & 1;
+      matches[i + lane] = bit;
+      equalCount += bit;
+    }
+  }
+  for (; i < count; i++) {
+    uint8_t bit = a[i] == b[i] ? 1 : 0;
+    matches[i] = bit;
+    equalCount += bit;
+  }
+  return equalCount;
+}
+
+// Axis-aligned box around every point; throws on an empty set
+inline BoundingBox computeBounds(const PointArray& points) {
+  if (points.empty()) {
+    throw std::invalid_argument("Cannot bound an empty point set");
+  }
+  const int32_t* lanes[3] = {points.x(), points.y(), points.z()};
+  int32_t lows[3], highs[3];
+  size_t count = points.size();
+  for (int axis = 0; axis < 3; axis++) {
+    const int32_t* lane = lanes[axis];
+    IntPack low = IntPack::broadcast(lane[0]);
+    IntPack high = low;
+    size_t i = 0;
+    for (; i + IntPack::width <= count; i += IntPack::width) {
+      IntPack values = IntPack::load(lane + i);
+      low = low.min(values);
+      high = high.max(values);
+    }
+    int32_t lowLanes[IntPack::width], highLanes[IntPack::width];
+    low.store(lowLanes);
+    high.store(highLanes);
+    lows[axis] = lowLanes[0];
+    highs[axis] = highLanes[0];
+    for (size_t lane = 1; lane < IntPack::width; lane++) {
+      lows[axis] = lowLanes[lane] < lows[axis] ? lowLanes[lane] : lows[axis];
+      highs[axis] =
+          highLanes[lane] > highs[axis] ? highLanes[lane] : highs[axis];
+    }
+    for (; i < count; i++) {
+      lows[axis] = lane[i] < lows[axis] ? lane[i] : lows[axis];
+      highs[axis] = lane[i] > highs[axis] ? lane[i] : highs[axis];
+    }
+  }
+  return BoundingBox(Point3D(lows[0], lows[1], lows[2]),
+                     Point3D(highs[0], highs[1], highs[2]));
+}
+
+// Multiplies every 16.16 position by a fixed-point factor. Products need
+// 64-bit intermediates that SSE2 cannot form per lane, so this stays scalar
+// and reuses Fixed's rounding rule to keep results identical everywhere.
+inline void scaleFixed(PointArray& positions, Fixed factor) {
+  int32_t* lanes[3] = {positions.x(), positions.y(), positions.z()};
+  for (int axis = 0; axis < 3; axis++) {
+    int32_t* lane = lanes[axis];
+    for (size_t i = 0; i < positions.size(); i++) {
+      lane[i] = (Fixed::fromRaw(lane[i]) * factor).rawValue();
+    }
+  }
+}
+
+#endif  // POINT_ARRAY_H
@@ -0,0 +1,373 @@
+#ifndef SPATIAL_HASH_MAP_H
+#define SPATIAL_HASH_MAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#include "Point.h"
+
+// Sixteen control bytes, one per slot, probed together. A full slot stores
+// the low 7 bits of its key's hash, so most mismatches are rejected without
+// touching the slot itself.
+class ControlGroup {
+ public:
+  static constexpr size_t width = 16;
+  static constexpr int8_t kEmpty = -128;  // 0b10000000
+  static constexpr int8_t kDeleted = -2;  // 0b11111110
+
+ private:
+#if defined(__SSE2__)
+  __m128i bytes;
+#else
+  const int8_t* bytes;
+#endif
+
+ public:
+  explicit ControlGroup(const int8_t* control) {
+#if defined(__SSE2__)
+    bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(control));
+#else
+    bytes = control;
+#endif
+  }
+
+  // Bit i is set where control byte i equals tag
+  uint32_t match(int8_t tag) const {
+#if defined(__SSE2__)
+    return static_cast<uint32_t>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(tag))));
+#else
+    uint32_t mask = 0;
+    for (size_t i = 0; i < width; i++) {
+      mask |= uint32_t(bytes[i] == tag) << i;
+    }
+    return mask;
+#endif
+  }
+
+  uint32_t matchEmpty() const { return match(kEmpty); }
+
+  // Empty and deleted bytes are the only ones with the sign bit set
+  uint32_t matchEmptyOrDeleted() const {
+#if defined(__SSE2__)
+    return static_cast<uint32_t>(_mm_movemask_epi8(bytes));
+#else
+    uint32_t mask = 0;
+    for (size_t i = 0; i < width; i++) {
+      mask |= uint32_t(bytes[i] < 0) << i;
+    }
+    return mask;
+#endif
+  }
+};
+
+inline int lowestBit(uint32_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_ctz(mask);
+#else
+  int bit = 0;
+  while (!(mask & 1)) {
+    mask >>= 1;
+    bit++;
+  }
+  return bit;
+#endif
+}
+
+// Open-addressing hash map from grid cells to values, laid out like a Swiss
+// table: a flat array of slots plus one control byte per slot, probed a
+// group of 16 at a time. The map keeps at most 7/8 of its slots in use and
+// doubles when it would go past that.
+template <typename V>
+class SpatialHashMap {
+ public:
+  struct Slot {
+    Point3D key;
+    V value;
+  };
+
+  SpatialHashMap()
+      : control(nullptr), slots(nullptr), slotCount(0), count(0),
+        growthLeft(0) {}
+
+  explicit SpatialHashMap(size_t expected) : SpatialHashMap() {
+    reserve(expected);
+  }
+
+  ~SpatialHashMap() {
+    clear();
+    release();
+  }
+
+  SpatialHashMap(SpatialHashMap&& other) noexcept : SpatialHashMap() {
+    swap(other);
+  }
+
+  SpatialHashMap& operator=(SpatialHashMap&& other) noexcept {
+    if (this != &other) {
+      SpatialHashMap moved(std::move(other));
+      swap(moved);
+    }
+    return *this;
+  }
+
+  SpatialHashMap(const SpatialHashMap&) = delete;
+  SpatialHashMap& operator=(const SpatialHashMap&) = delete;
+
+  size_t size() const { return count; }
+  bool empty() const { return count == 0; }
+  size_t capacity() const { return slotCount; }
+
+  // Makes room for expected entries without rehashing
+  void reserve(size_t expected) {
+    size_t needed = ControlGroup::width;
+    while (needed * 7 / 8 < expected) {
+      needed *= 2;
+    }
+    if (needed > slotCount) {
+      rehash(needed);
+    }
+  }
+
+  // Returns false, leaving the map unchanged, if key is already present
+  bool insert(const Point3D& key, const V& value) {
+    return emplace(key, value).second;
+  }
+
+  template <typename... Args>
+  std::pair<V*, bool> emplace(const Point3D& key, Args&&... args) {
+    uint64_t hash = hashPoint(key);
+    size_t index = findIndex(key, hash);
+    if (index != kNotFound) {
+      return std::make_pair(&slots[index].value, false);
+    }
+    index = prepareInsert(hash);
+    // The slot is only claimed once the value exists, so a throwing
+    // constructor leaves the map as it was
+    new (&slots[index]) Slot{key, V(std::forward<Args>(args)...)};
+    claim(index, hash);
+    return std::make_pair(&slots[index].value, true);
+  }
+
+  // Value for key, default-constructed if it was missing
+  V& operator[](const Point3D& key) { return *emplace(key).first; }
+
+  V* find(const Point3D& key) {
+    size_t index = findIndex(key, hashPoint(key));
+    return index == kNotFound ? nullptr : &slots[index].value;
+  }
+
+  const V* find(const Point3D& key) const {
+    size_t index = findIndex(key, hashPoint(key));
+    return index == kNotFound ? nullptr : &slots[index].value;
+  }
+
+  bool contains(const Point3D& key) const { return find(key) != nullptr; }
+
+  bool erase(const Point3D& key) {
+    size_t index = findIndex(key, hashPoint(key));
+    if (index == kNotFound) {
+      return false;
+    }
+    slots[index].~Slot();
+    count--;
+    // A probe stops at the first group with an empty byte. If this group
+    // has one, no probe can have passed through it, so the slot can become
+    // empty again; otherwise it must stay a tombstone.
+    size_t groupStart = index & ~(ControlGroup::width - 1);
+    if (ControlGroup(control + groupStart).matchEmpty() != 0) {
+      control[index] = ControlGroup::kEmpty;
+      growthLeft++;
+    } else {
+      control[index] = ControlGroup::kDeleted;
+    }
+    return true;
+  }
+
+  void clear() {
+    for (size_t i = 0; i < slotCount; i++) {
+      if (control[i] >= 0) {
+        slots[i].~Slot();
+      }
+    }
+    if (slotCount > 0) {
+      std::memset(control, ControlGroup::kEmpty, slotCount);
+    }
+    count = 0;
+    growthLeft = maxLoad(slotCount);
+  }
+
+  // Calls visit(key, value) for every entry, in no particular order
+  template <typename Visitor>
+  void forEach(Visitor visit) const {
+    for (size_t i = 0; i < slotCount; i++) {
+      if (control[i] >= 0) {
+        visit(slots[i].key, slots[i].value);
+      }
+    }
+  }
+
+  // Calls visit(key, value) for every occupied cell in the cube of side
+  // 2 * radius + 1 centred on center, center itself included
+  template <typename Visitor>
+  void forEachNeighbour(const Point3D& center, int radius,
+                        Visitor visit) const {
+    for (int dz = -radius; dz <= radius; dz++) {
+      for (int dy = -radius; dy <= radius; dy++) {
+        for (int dx = -radius; dx <= radius; dx++) {
+          Point3D cell(center.x + dx, center.y + dy, center.z + dz);
+          if (const V* value = find(cell)) {
+            visit(cell, *value);
+          }
+        }
+      }
+    }
+  }
+
+  // Number of occupied cells within radius of center (3x3x3 by default)
+  size_t countNeighbours(const Point3D& center, int radius = 1) const {
+    size_t found = 0;
+    forEachNeighbour(center, radius,
+                     [&found](const Point3D&, const V&) { found++; });
+    return found;
+  }
+
+  void swap(SpatialHashMap& other) noexcept {
+    std::swap(control, other.control);
+    std::swap(slots, other.slots);
+    std::swap(slotCount, other.slotCount);
+    std::swap(count, other.count);
+    std::swap(growthLeft, other.growthLeft);
+  }
+
+ private:
+  static constexpr size_t kNotFound = static_cast<size_t>(-1);
+  static constexpr size_t kKeepProbing = static_cast<size_t>(-2);
+
+  int8_t* control;
+  Slot* slots;
+  size_t slotCount;  // Zero or a power of two, at least one group
+  size_t count;
+  size_t growthLeft;  // Empty slots that may still be filled before growing
+
+  static size_t maxLoad(size_t slots) { return slots - slots / 8; }
+
+  // The high bits pick the starting group, the low 7 bits become the tag
+  static size_t homeGroup(uint64_t hash) { return size_t(hash >> 7); }
+  static int8_t tag(uint64_t hash) { return int8_t(hash & 0x7f); }
+
+  // Visits groups in triangular order (g, g+1, g+3, g+6, ...), which reaches
+  // every group exactly once when the group count is a power of two. Stops
+  // at the first group for which probe returns something other than
+  // kKeepProbing.
+  template <typename Probe>
+  size_t probeGroups(uint64_t hash, Probe probe) const {
+    size_t groupMask = slotCount / ControlGroup::width - 1;
+    size_t group = homeGroup(hash) & groupMask;
+    for (size_t step = 1; step <= groupMask + 1; step++) {
+      size_t found = probe(group * ControlGroup::width);
+      if (found != kKeepProbing) {
+        return found;
+      }
+      group = (group + step) & groupMask;
+    }
+    return kKeepProbing;
+  }
+
+  size_t findIndex(const Point3D& key, uint64_t hash) const {
+    if (slotCount == 0) {
+      return kNotFound;
+    }
+    int8_t wanted = tag(hash);
+    size_t index = probeGroups(hash, [&](size_t start) {
+      ControlGroup group(control + start);
+      for (uint32_t mask = group.match(wanted); mask != 0; mask &= mask - 1) {
+        size_t candidate = start + lowestBit(mask);
+        if (slots[candidate].key == key) {
+          return candidate;
+        }
+      }
+      // Inserts fill the first group with room, so an empty byte here means
+      // the key was never placed further along
+      return group.matchEmpty() != 0 ? kNotFound : kKeepProbing;
+    });
+    return index == kKeepProbing ? kNotFound : index;
+  }
+
+  // Finds a free slot for a key known to be absent, growing the table if
+  // needed, and returns its index. The slot stays free until claimed.
+  size_t prepareInsert(uint64_t hash) {
+    if (slotCount == 0) {
+      rehash(ControlGroup::width);
+    } else if (growthLeft == 0) {
+      // Mostly tombstones: rebuilding at the same size frees them.
+      // Otherwise the table really is full and doubles.
+      rehash(count < maxLoad(slotCount) / 2 ? slotCount : slotCount * 2);
+    }
+    return probeGroups(hash, [this](size_t start) {
+      uint32_t mask = ControlGroup(control + start).matchEmptyOrDeleted();
+      return mask != 0 ? start + lowestBit(mask) : kKeepProbing;
+    });
+  }
+
+  // Marks the slot from prepareInsert full, after its Slot was constructed
+  void claim(size_t index, uint64_t hash) {
+    if (control[index] == ControlGroup::kEmpty) {
+      growthLeft--;
+    }
+    control[index] = tag(hash);
+    count++;
+  }
+
+  void rehash(size_t newSlotCount) {
+    int8_t* oldControl = control;
+    Slot* oldSlots = slots;
+    size_t oldSlotCount = slotCount;
+
+    control = new int8_t[newSlotCount];
+    std::memset(control, ControlGroup::kEmpty, newSlotCount);
+    slots = std::allocator<Slot>().allocate(newSlotCount);
+    slotCount = newSlotCount;
+    growthLeft = maxLoad(newSlotCount) - count;
+
+    for (size_t i = 0; i < oldSlotCount; i++) {
+      if (oldControl[i] < 0) {
+        continue;
+      }
+      uint64_t hash = hashPoint(oldSlots[i].key);
+      size_t index = probeGroups(hash, [this](size_t start) {
+        uint32_t mask = ControlGroup(control + start).matchEmpty();
+        return mask != 0 ? start + lowestBit(mask) : kKeepProbing;
+      });
+      control[index] = tag(hash);
+      new (&slots[index]) Slot(std::move(oldSlots[i]));
+      oldSlots[i].~Slot();
+    }
+
+    if (oldSlotCount > 0) {
+      delete[] oldControl;
+      std::allocator<Slot>().deallocate(oldSlots, oldSlotCount);
+    }
+  }
+
+  void release() {
+    if (slotCount > 0) {
+      delete[] control;
+      std::allocator<Slot>().deallocate(slots, slotCount);
+    }
+    control = nullptr;
+    slots = nullptr;
+    slotCount = 0;
+    growthLeft = 0;
+  }
+};
+
+#endif  // SPATIAL_HASH_MAP_H
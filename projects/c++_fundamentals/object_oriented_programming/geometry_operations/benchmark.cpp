@@ -0,0 +1,157 @@
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "FixedPoint.h"
+#include "Point.h"
+#include "PointArray.h"
+
+using std::cout;
+using std::endl;
+
+const size_t kCount = 1000000;
+const int kSteps = 50;
+
+template <typename Function>
+double nanosecondsPerPoint(Function step) {
+  auto begin = std::chrono::steady_clock::now();
+  for (int s = 0; s < kSteps; s++) {
+    step();
+  }
+  return std::chrono::duration<double, std::nano>(
+             std::chrono::steady_clock::now() - begin)
+             .count() /
+         (static_cast<double>(kCount) * kSteps);
+}
+
+void printRow(const std::string& name, double ns, double baseline,
+              int64_t checksum) {
+  cout << std::setw(30) << name << std::setw(12) << ns << std::setw(10)
+       << baseline / ns << std::setw(18) << checksum << endl;
+}
+
+// Deterministic coordinates in roughly +-2^20 so sums never overflow
+int32_t coordinate(size_t i, uint32_t seed) {
+  uint32_t h = static_cast<uint32_t>(i) * 2654435761u ^ seed;
+  return static_cast<int32_t>(h % 2097152) - 1048576;
+}
+
+int main() {
+  cout << "Point kernels over " << kCount << " points, " << kSteps
+       << " passes, IntPack width " << IntPack::width << endl;
+  cout << std::fixed << std::setprecision(3);
+  cout << std::setw(30) << "kernel" << std::setw(12) << "ns/point"
+       << std::setw(10) << "speedup" << std::setw(18) << "checksum" << endl;
+
+  std::vector<Point3D> positions(kCount), velocities(kCount);
+  PointArray positionsSoA, velocitiesSoA;
+  positionsSoA.reserve(kCount);
+  velocitiesSoA.reserve(kCount);
+  for (size_t i = 0; i < kCount; i++) {
+    positions[i] =
+        Point3D(coordinate(i, 1), coordinate(i, 2), coordinate(i, 3));
+    velocities[i] = Point3D(i % 7 - 3, i % 5 - 2, i % 3 - 1);
+    positionsSoA.push_back(positions[i]);
+    velocitiesSoA.push_back(velocities[i]);
+  }
+
+  // Add: position = position + velocity, then undo it so values stay bounded
+  double aosAdd = nanosecondsPerPoint([&]() {
+    for (size_t i = 0; i < kCount; i++) {
+      positions[i] = positions[i] + velocities[i];
+    }
+  });
+  printRow("add, vector<Point3D>", aosAdd, aosAdd,
+           positions[12345].x + positions[12345].z);
+  double soaAdd = nanosecondsPerPoint(
+      [&]() { addPoints(positionsSoA, velocitiesSoA, positionsSoA); });
+  printRow("add, PointArray", soaAdd, aosAdd,
+           positionsSoA[12345].x + positionsSoA[12345].z);
+
+  double aosSub = nanosecondsPerPoint([&]() {
+    for (size_t i = 0; i < kCount; i++) {
+      positions[i] = positions[i] - velocities[i];
+    }
+  });
+  printRow("sub, vector<Point3D>", aosSub, aosSub,
+           positions[12345].x + positions[12345].z);
+  double soaSub = nanosecondsPerPoint(
+      [&]() { subPoints(positionsSoA, velocitiesSoA, positionsSoA); });
+  printRow("sub, PointArray", soaSub, aosSub,
+           positionsSoA[12345].x + positionsSoA[12345].z);
+
+  // Compare: how many points are unchanged against a reference copy
+  std::vector<Point3D> reference = positions;
+  PointArray referenceSoA = positionsSoA;
+  for (size_t i = 0; i < kCount; i += 3) {
+    reference[i].z++;
+    Point3D moved = referenceSoA[i];
+    moved.z++;
+    referenceSoA.set(i, moved);
+  }
+  int64_t aosEqual = 0;
+  double aosCompare = nanosecondsPerPoint([&]() {
+    aosEqual = 0;
+    for (size_t i = 0; i < kCount; i++) {
+      aosEqual += positions[i] == reference[i];
+    }
+  });
+  printRow("compare, vector<Point3D>", aosCompare, aosCompare, aosEqual);
+  std::vector<uint8_t> matches;
+  int64_t soaEqual = 0;
+  double soaCompare = nanosecondsPerPoint([&]() {
+    soaEqual = comparePoints(positionsSoA, referenceSoA, matches);
+  });
+  printRow("compare, PointArray", soaCompare, aosCompare, soaEqual);
+
+  BoundingBox aosBounds;
+  double aosBox = nanosecondsPerPoint([&]() {
+    Point3D low = positions[0], high = positions[0];
+    for (size_t i = 1; i < kCount; i++) {
+      const Point3D& p = positions[i];
+      low = Point3D(p.x < low.x ? p.x : low.x, p.y < low.y ? p.y : low.y,
+                    p.z < low.z ? p.z : low.z);
+      high = Point3D(p.x > high.x ? p.x : high.x, p.y > high.y ? p.y : high.y,
+                     p.z > high.z ? p.z : high.z);
+    }
+    aosBounds = BoundingBox(low, high);
+  });
+  printRow("bounds, vector<Point3D>", aosBox, aosBox,
+           int64_t(aosBounds.max.x) - aosBounds.min.x);
+  BoundingBox soaBounds;
+  double soaBox =
+      nanosecondsPerPoint([&]() { soaBounds = computeBounds(positionsSoA); });
+  printRow("bounds, PointArray", soaBox, aosBox,
+           int64_t(soaBounds.max.x) - soaBounds.min.x);
+
+  // 16.16 positions stepped by a fixed-point velocity
+  std::vector<FixedVec3> fixedPositions(kCount);
+  PointArray fixedSoA;
+  fixedSoA.reserve(kCount);
+  FixedVec3 drift(Fixed::fromRatio(1, 3), Fixed::fromRatio(-1, 7),
+                  Fixed::fromRatio(1, 60));
+  for (size_t i = 0; i < kCount; i++) {
+    fixedPositions[i] = FixedVec3(Point3D(i % 1000, i % 777, i % 555));
+    fixedSoA.push_back(fixedPositions[i]);
+  }
+  double fixedAos = nanosecondsPerPoint([&]() {
+    for (size_t i = 0; i < kCount; i++) {
+      fixedPositions[i] = fixedPositions[i] + drift;
+    }
+  });
+  printRow("fixed translate, vector<FixedVec3>", fixedAos, fixedAos,
+           fixedPositions[12345].x.rawValue());
+  double fixedSoa =
+      nanosecondsPerPoint([&]() { translate(fixedSoA, drift); });
+  printRow("fixed translate, PointArray", fixedSoa, fixedAos,
+           fixedSoA.fixedAt(12345).x.rawValue());
+
+  bool identical = aosBounds.min == soaBounds.min &&
+                   aosBounds.max == soaBounds.max && aosEqual == soaEqual &&
+                   fixedPositions[12345] == fixedSoA.fixedAt(12345);
+  cout << "Results match: " << (identical ? "yes" : "NO") << endl;
+  return identical ? 0 : 1;
+}
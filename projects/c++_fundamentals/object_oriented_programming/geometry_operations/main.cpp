@@ -1,47 +1,10 @@
 #include <iostream>
+#include <string>
 
-class Point {
- public:
-  int x, y;
-
-  Point(int x = 0, int y = 0) : x(x), y(y) {}
-
-  Point operator+(const Point& point) const {
-    return Point(x + point.x, y + point.y);
-  }
-
-  Point operator-(const Point& point) const {
-    return Point(x - point.x, y - point.y);
-  }
-
-  bool operator==(const Point& point) const {
-    return x == point.x && y == point.y;
-  }
-
-  bool operator!=(const Point& point) const { return !(*this == point); }
-};
-
-class Point3D : public Point {
- public:
-  int z;
-
-  Point3D(int x = 0, int y = 0, int z = 0) : Point(x, y), z(z) {}
-
-  Point3D operator+(const Point3D& point) const {
-    Point p = Point(this->x, this->y) + Point(point.x, point.y);
-    return Point3D(p.x, p.y, z + point.z);
-  }
-
-  Point3D operator-(const Point3D& point) const {
-    return Point3D(x - point.x, y - point.y, z - point.z);
-  }
-
-  bool operator==(const Point3D& point) const {
-    return x == point.x && y == point.y && z == point.z;
-  }
-
-  bool operator!=(const Point3D& point) const { return !(*this == point); }
-};
+#include "FixedPoint.h"
+#include "Point.h"
+#include "PointArray.h"
+#include "SpatialHashMap.h"
 
 int main() {
   Point p1(1, 2), p2(3, 4);
@@ -52,5 +15,42 @@ int main() {
   Point3D p6 = p4 + p5;
   std::cout << "p6: (" << p6.x << ", " << p6.y << ", " << p6.z << ")\n";
 
+  // Fixed-point positions give the same bits on every machine
+  FixedVec3 position(p4);
+  FixedVec3 velocity(Fixed::fromRatio(1, 3), Fixed::fromRatio(-1, 2),
+                     Fixed::fromInt(2));
+  for (int tick = 0; tick < 3; tick++) {
+    position = position + velocity;
+  }
+  std::cout << "position after 3 ticks: (" << position.x.toDouble() << ", "
+            << position.y.toDouble() << ", " << position.z.toDouble()
+            << "), cell (" << position.toPoint().x << ", "
+            << position.toPoint().y << ", " << position.toPoint().z << ")\n";
+
+  PointArray points;
+  for (int i = 0; i < 10; i++) {
+    points.push_back(Point3D(i, -i * 2, i % 3));
+  }
+  translate(points, Point3D(5, 5, 5));
+  BoundingBox bounds = computeBounds(points);
+  std::cout << "bounds: (" << bounds.min.x << ", " << bounds.min.y << ", "
+            << bounds.min.z << ") to (" << bounds.max.x << ", "
+            << bounds.max.y << ", " << bounds.max.z << ")\n";
+
+  // Sparse world: only occupied cells are stored
+  SpatialHashMap<std::string> world;
+  world.insert(Point3D(0, 0, 0), "spawn");
+  world.insert(Point3D(1, 0, 0), "chest");
+  world.insert(Point3D(0, -1, 1), "torch");
+  world.insert(Point3D(5, 5, 5), "tree");
+  std::cout << "cells next to spawn: " << world.countNeighbours(Point3D())
+            << "\n";
+  world.forEachNeighbour(Point3D(), 1,
+                         [](const Point3D& cell, const std::string& name) {
+                           std::cout << "  (" << cell.x << ", " << cell.y
+                                     << ", " << cell.z << ") " << name
+                                     << "\n";
+                         });
+
   return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,202 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <algorithm>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Point.h"
+#include "SpatialHashMap.h"
+
+using std::cout;
+using std::endl;
+
+struct PointLess {
+  bool operator()(const Point3D& a, const Point3D& b) const {
+    if (a.x != b.x) return a.x < b.x;
+    if (a.y != b.y) return a.y < b.y;
+    return a.z < b.z;
+  }
+};
+
+// Counts live instances and throws from every seventh construction
+struct Fragile {
+  static int live;
+  static int constructed;
+
+  explicit Fragile(int) {
+    if (++constructed % 7 == 0) {
+      throw std::runtime_error("Fragile construction failed");
+    }
+    live++;
+  }
+  Fragile(Fragile&&) { live++; }
+  ~Fragile() { live--; }
+};
+int Fragile::live = 0;
+int Fragile::constructed = 0;
+
+// A value whose constructor throws must leave no trace in the map
+bool emplaceIsExceptionSafe(const std::vector<Point3D>& cells) {
+  {
+    SpatialHashMap<Fragile> map;
+    size_t stored = 0;
+    for (size_t i = 0; i < cells.size(); i++) {
+      try {
+        map.emplace(cells[i], int(i));
+        stored++;
+      } catch (const std::runtime_error&) {
+        if (map.contains(cells[i])) {
+          return false;
+        }
+      }
+    }
+    if (map.size() != stored || Fragile::live != int(stored)) {
+      return false;
+    }
+  }
+  return Fragile::live == 0;
+}
+
+template <typename Function>
+double millionsPerSecond(size_t operations, Function run) {
+  auto begin = std::chrono::steady_clock::now();
+  run();
+  double seconds = std::chrono::duration<double>(
+                       std::chrono::steady_clock::now() - begin)
+                       .count();
+  return operations / seconds / 1e6;
+}
+
+void printRow(const std::string& name, double insert, double hit, double miss,
+              double neighbours, int64_t checksum) {
+  cout << std::setw(22) << name << std::setw(10) << insert << std::setw(10)
+       << hit << std::setw(10) << miss << std::setw(14) << neighbours
+       << std::setw(14) << checksum << endl;
+}
+
+// Inserts every cell, then looks up occupied cells, empty cells and the 26
+// neighbours of each occupied cell. Rates are millions of operations per
+// second (one neighbour query = 27 lookups).
+template <typename Insert, typename Lookup>
+void run(const std::string& name, const std::vector<Point3D>& cells,
+         const std::vector<Point3D>& missing, Insert insert, Lookup lookup) {
+  int64_t checksum = 0;
+  double insertRate =
+      millionsPerSecond(cells.size(), [&]() {
+        for (size_t i = 0; i < cells.size(); i++) {
+          insert(cells[i], static_cast<int>(i));
+        }
+      });
+  double hitRate = millionsPerSecond(cells.size(), [&]() {
+    for (const Point3D& cell : cells) {
+      checksum += *lookup(cell);
+    }
+  });
+  double missRate = millionsPerSecond(missing.size(), [&]() {
+    for (const Point3D& cell : missing) {
+      checksum += lookup(cell) != nullptr;
+    }
+  });
+  double neighbourRate = millionsPerSecond(cells.size(), [&]() {
+    for (const Point3D& cell : cells) {
+      for (int dz = -1; dz <= 1; dz++) {
+        for (int dy = -1; dy <= 1; dy++) {
+          for (int dx = -1; dx <= 1; dx++) {
+            checksum += lookup(Point3D(cell.x + dx, cell.y + dy,
+                                       cell.z + dz)) != nullptr;
+          }
+        }
+      }
+    }
+  });
+  printRow(name, insertRate, hitRate, missRate, neighbourRate, checksum);
+}
+
+int main(int argc, char* argv[]) {
+  size_t count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+
+  // Occupied cells scattered through a cube with about 1 cell in 8 filled
+  int side = 2;
+  while (static_cast<size_t>(side) * side * side < count * 8) {
+    side *= 2;
+  }
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<int> axis(-side / 2, side / 2 - 1);
+  std::unordered_map<Point3D, int> unique;
+  std::vector<Point3D> cells, missing;
+  while (cells.size() < count) {
+    Point3D cell(axis(rng), axis(rng), axis(rng));
+    if (unique.emplace(cell, 0).second) {
+      cells.push_back(cell);
+    }
+  }
+  while (missing.size() < count) {
+    Point3D cell(axis(rng), axis(rng), axis(rng));
+    if (unique.count(cell) == 0) {
+      missing.push_back(cell);
+    }
+  }
+  std::shuffle(cells.begin(), cells.end(), rng);
+
+  cout << count << " occupied cells in a " << side << "^3 world" << endl;
+  cout << std::fixed << std::setprecision(2);
+  cout << std::setw(22) << "container" << std::setw(10) << "insert"
+       << std::setw(10) << "hit" << std::setw(10) << "miss" << std::setw(14)
+       << "neighbours" << std::setw(14) << "checksum" << endl;
+
+  {
+    std::map<Point3D, int, PointLess> map;
+    run("std::map", cells, missing,
+        [&](const Point3D& key, int value) { map.emplace(key, value); },
+        [&](const Point3D& key) -> const int* {
+          auto it = map.find(key);
+          return it == map.end() ? nullptr : &it->second;
+        });
+  }
+  {
+    std::unordered_map<Point3D, int> map;
+    run("std::unordered_map", cells, missing,
+        [&](const Point3D& key, int value) { map.emplace(key, value); },
+        [&](const Point3D& key) -> const int* {
+          auto it = map.find(key);
+          return it == map.end() ? nullptr : &it->second;
+        });
+  }
+  {
+    SpatialHashMap<int> map;
+    run("SpatialHashMap", cells, missing,
+        [&](const Point3D& key, int value) { map.insert(key, value); },
+        [&](const Point3D& key) { return map.find(key); });
+
+    // Erase half the cells and check everything is still found correctly
+    for (size_t i = 0; i < cells.size(); i += 2) {
+      map.erase(cells[i]);
+    }
+    for (size_t i = 0; i < cells.size(); i++) {
+      const int* value = map.find(cells[i]);
+      bool expected = i % 2 == 1;
+      if ((value != nullptr) != expected ||
+          (value && *value != static_cast<int>(i))) {
+        cout << "SpatialHashMap lost cell " << i << endl;
+        return 1;
+      }
+    }
+    cout << "SpatialHashMap erase check passed, " << map.size()
+         << " cells left" << endl;
+  }
+
+  if (!emplaceIsExceptionSafe(cells)) {
+    cout << "SpatialHashMap kept a slot whose value failed to construct"
+         << endl;
+    return 1;
+  }
+  cout << "SpatialHashMap exception check passed" << endl;
+  return 0;
+}
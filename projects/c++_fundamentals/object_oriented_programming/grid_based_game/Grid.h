@@ -0,0 +1,39 @@
+#ifndef GRID_H
+#define GRID_H
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "../../profiler/Profiler.h"
+
+class Entity {
+ public:
+  int id;
+
+  Entity(int id) : id(id) {}
+};
+
+class Grid {
+ private:
+  std::vector<std::vector<std::shared_ptr<Entity>>> grid;
+
+ public:
+  Grid(int rows, int columns)
+      : grid(rows, std::vector<std::shared_ptr<Entity>>(columns, nullptr)) {}
+
+  int getRows() const { return int(grid.size()); }
+  int getColumns() const { return grid.empty() ? 0 : int(grid[0].size()); }
+
+  std::shared_ptr<Entity>& operator()(int row, int column) {
+    PROFILE_ZONE("Grid::operator()");
+    if (row < 0 || row >= int(grid.size()) || column < 0 ||
+        column >= int(grid[0].size())) {
+      throw std::out_of_range("Index out of range");
+    }
+
+    return grid[row][column];
+  }
+};
+
+#endif  // GRID_H
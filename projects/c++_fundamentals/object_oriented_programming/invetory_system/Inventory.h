@@ -0,0 +1,114 @@
+#ifndef INVENTORY_H
+#define INVENTORY_H
+
+#include <algorithm>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../../profiler/Profiler.h"
+#include "../game_events/Uuid.h"
+
+using std::cout;
+using std::endl;
+using std::string;
+using std::vector;
+
+class Item {
+ private:
+  int usage = 100;
+  string id;
+
+ public:
+  Item() { id = generate_uuid_v4(); }
+  virtual void use() = 0;
+
+  string getId() { return id; }
+  int getUsage() { return usage; }
+  void setUsage(int newUsage) { usage = newUsage; }
+
+  bool operator==(const Item* item) { return item->id == this->id; }
+};
+
+class Potion : public Item {
+ protected:
+  void use() {
+    if (this->getUsage() > 0) {
+      this->setUsage(0);
+      cout << "potion has been used" << endl;
+    } else {
+      cout << "this potion is already used" << endl;
+    }
+  }
+};
+
+class Weapon : public Item {
+ protected:
+  void use() {
+    if (this->getUsage() <= 0) {
+      cout << "this Weapon is broken" << endl;
+      return;
+    }
+    int amountUsed = this->getUsage() - 10;
+    if (amountUsed > 0) {
+      this->setUsage(amountUsed);
+    } else {
+      this->setUsage(0);
+    }
+    cout << "Weapon used! life remain:" << this->getUsage() << endl;
+  }
+};
+
+class Armor : public Item {
+ protected:
+  void use() {
+    if (this->getUsage() <= 0) {
+      cout << "this Armor is broken" << endl;
+      return;
+    }
+    int amountUsed = this->getUsage() - 20;
+    if (amountUsed > 0) {
+      this->setUsage(amountUsed);
+
+    } else {
+      this->setUsage(0);
+    }
+    cout << "Armor used! life remain:" << this->getUsage() << endl;
+  }
+};
+
+class Inventory {
+ private:
+  vector<Item*> itens;
+
+ public:
+  void add(Item* item) { itens.push_back(item); };
+
+  void remove(Item* item) {
+    for (auto it = itens.begin(); it != itens.end();) {
+      if (*it == item) {
+        it = itens.erase(it);
+      } else {
+        it++;
+      }
+    }
+  }
+
+  void size() { cout << "Size is: " << itens.size() << endl; }
+
+  const vector<Item*>& getItems() const { return itens; }
+
+  void use(Item* item) {
+    PROFILE_ZONE("Inventory::use");
+    bool isItemInArray =
+        std::find(std::begin(itens), std::end(itens), item) != std::end(itens);
+    if (!isItemInArray) {
+      throw std::out_of_range("Item not found ");
+    } else {
+      item->use();
+    }
+  };
+};
+
+#endif  // INVENTORY_H
@@ -0,0 +1,139 @@
+#include "GameState.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+
+const size_t kCharacterBytes = sizeof(Character::State);
+const size_t kItemBytes = sizeof(int32_t);
+const size_t kCellBytes = sizeof(int32_t);
+
+// The range of elements of size elementBytes, stored from regionStart to
+// regionEnd, that overlap bytes [begin, end)
+void overlap(size_t begin, size_t end, size_t regionStart, size_t regionEnd,
+             size_t elementBytes, size_t& first, size_t& last) {
+  begin = std::max(begin, regionStart);
+  end = std::min(end, regionEnd);
+  if (begin >= end) {
+    first = last = 0;
+    return;
+  }
+  first = (begin - regionStart) / elementBytes;
+  last = (end - regionStart + elementBytes - 1) / elementBytes;
+}
+
+}  // namespace
+
+GameState::GameState(Fight& fight, Inventory& inventory, Grid& grid,
+                     const std::vector<std::shared_ptr<Entity>>& entities,
+                     size_t chunkSize)
+    : fight(fight),
+      inventory(inventory),
+      grid(grid),
+      charactersOffset(sizeof(uint32_t)),
+      itemsOffset(charactersOffset + fight.size() * kCharacterBytes),
+      cellsOffset(itemsOffset + inventory.getItems().size() * kItemBytes),
+      state(cellsOffset + size_t(grid.getRows()) * grid.getColumns() *
+                              kCellBytes,
+            chunkSize) {
+  for (const std::shared_ptr<Entity>& entity : entities) {
+    if (entity->id == kEmptyCell ||
+        !entitiesById.emplace(entity->id, entity).second) {
+      throw std::invalid_argument("Entity ids must be distinct");
+    }
+  }
+}
+
+void GameState::capture() {
+  state.put(0, fight.tick());
+  for (size_t i = 0; i < fight.size(); i++) {
+    state.put(charactersOffset + i * kCharacterBytes, fight[i].saveState());
+  }
+
+  const vector<Item*>& items = inventory.getItems();
+  std::vector<int32_t> values(items.size());
+  for (size_t i = 0; i < items.size(); i++) {
+    values[i] = items[i]->getUsage();
+  }
+  state.write(itemsOffset, values.data(), values.size() * kItemBytes);
+
+  // A row at a time, so the image compares whole rows
+  values.resize(grid.getColumns());
+  for (int row = 0; row < grid.getRows(); row++) {
+    for (int column = 0; column < grid.getColumns(); column++) {
+      const std::shared_ptr<Entity>& cell = grid(row, column);
+      values[column] = cell ? cell->id : kEmptyCell;
+    }
+    state.write(cellsOffset + size_t(row) * values.size() * kCellBytes,
+                values.data(), values.size() * kCellBytes);
+  }
+}
+
+void GameState::apply(size_t begin, size_t end) {
+  if (begin < charactersOffset) {
+    fight.setTick(state.get<uint32_t>(0));
+  }
+
+  size_t first, last;
+  overlap(begin, end, charactersOffset, itemsOffset, kCharacterBytes, first,
+          last);
+  for (size_t i = first; i < last; i++) {
+    fight[i].loadState(
+        state.get<Character::State>(charactersOffset + i * kCharacterBytes));
+  }
+
+  const vector<Item*>& items = inventory.getItems();
+  overlap(begin, end, itemsOffset, cellsOffset, kItemBytes, first, last);
+  for (size_t i = first; i < last; i++) {
+    items[i]->setUsage(state.get<int32_t>(itemsOffset + i * kItemBytes));
+  }
+
+  overlap(begin, end, cellsOffset, state.size(), kCellBytes, first, last);
+  for (size_t i = first; i < last; i++) {
+    int32_t id = state.get<int32_t>(cellsOffset + i * kCellBytes);
+    std::shared_ptr<Entity>& cell =
+        grid(int(i / grid.getColumns()), int(i % grid.getColumns()));
+    if (id == kEmptyCell) {
+      cell = nullptr;
+      continue;
+    }
+    auto entity = entitiesById.find(id);
+    if (entity == entitiesById.end()) {
+      throw std::logic_error(
+          "Grid held an entity the GameState was not given");
+    }
+    cell = entity->second;
+  }
+}
+
+Snapshot GameState::save() {
+  capture();
+  return state.snapshot();
+}
+
+void GameState::load(const Snapshot& snapshot) {
+  capture();
+  std::vector<size_t> changed = state.restore(snapshot);
+  // Neighbouring chunks are applied as one range, so an element straddling
+  // two of them is written back once
+  for (size_t i = 0; i < changed.size();) {
+    size_t j = i + 1;
+    while (j < changed.size() && changed[j] == changed[j - 1] + 1) {
+      j++;
+    }
+    apply(changed[i] * state.chunkSize(),
+          std::min(state.size(), (changed[j - 1] + 1) * state.chunkSize()));
+    i = j;
+  }
+}
+
+uint64_t GameState::hash() {
+  capture();
+  uint64_t hash = 14695981039346656037ull;
+  for (size_t i = 0; i < state.size(); i++) {
+    hash ^= state.data()[i];
+    hash *= 1099511628211ull;
+  }
+  return hash;
+}
@@ -0,0 +1,61 @@
+#ifndef GAME_STATE_H
+#define GAME_STATE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "../basic_game_characters/Replay.h"
+#include "../grid_based_game/Grid.h"
+#include "../invetory_system/Inventory.h"
+#include "StateImage.h"
+
+// Saves and restores a fight, an inventory and a grid together, for
+// rollback.
+//
+// The objects keep their state themselves; save() copies it into a
+// StateImage laid out as
+//   fight tick | Character::State per character | usage per item |
+//   entity id per grid cell, row by row
+// and snapshots the chunks that changed. load() first brings the image up
+// to date with the objects, restores the snapshot into it and writes back
+// into the objects only the parts covered by chunks that changed.
+//
+// The fight's characters, the inventory's items and the grid's size must
+// stay the same for the life of the GameState. Every entity that can be on
+// the grid must be passed in, with distinct ids, so cells can be restored.
+class GameState {
+ public:
+  GameState(Fight& fight, Inventory& inventory, Grid& grid,
+            const std::vector<std::shared_ptr<Entity>>& entities,
+            size_t chunkSize = 256);
+
+  Snapshot save();
+  void load(const Snapshot& snapshot);
+
+  // FNV-1a of the current state, for checking that two copies agree
+  uint64_t hash();
+
+  const StateImage& image() const { return state; }
+
+ private:
+  static constexpr int32_t kEmptyCell = INT32_MIN;
+
+  Fight& fight;
+  Inventory& inventory;
+  Grid& grid;
+  std::unordered_map<int32_t, std::shared_ptr<Entity>> entitiesById;
+
+  size_t charactersOffset;
+  size_t itemsOffset;
+  size_t cellsOffset;
+  StateImage state;
+
+  void capture();
+  // Writes image bytes [begin, end) back into the objects
+  void apply(size_t begin, size_t end);
+};
+
+#endif  // GAME_STATE_H
@@ -0,0 +1,103 @@
+#include "Match.h"
+
+#include <stdexcept>
+
+PlayerInput randomInput(std::mt19937& script, int player, int players,
+                        int items) {
+  PlayerInput input;
+  uint32_t roll = script() % 120;
+  if (roll < 40) {
+    input.move = int8_t(1 + roll % 4);
+  }
+  if (roll % 20 == 0 && players > 1) {
+    int other = int(script() % uint32_t(players - 1));
+    input.target = int8_t(other < player ? other : other + 1);
+  }
+  if (roll % 30 == 1 && items > 0) {
+    input.item = int8_t(script() % uint32_t(items));
+  }
+  return input;
+}
+
+Match::Match(const std::vector<Combatant>& roster, int items, int gridSize,
+             size_t chunkSize)
+    : fight(roster), grid(gridSize, gridSize) {
+  if (roster.size() > 127 || items > 127 ||
+      int(roster.size()) > gridSize * gridSize) {
+    throw std::invalid_argument("Too many players or items for a Match");
+  }
+  for (int i = 0; i < items; i++) {
+    switch (i % 3) {
+      case 0:
+        stock.emplace_back(new Potion());
+        break;
+      case 1:
+        stock.emplace_back(new Weapon());
+        break;
+      default:
+        stock.emplace_back(new Armor());
+        break;
+    }
+    inventory.add(stock.back().get());
+  }
+  // Players start spread along the diagonal
+  for (size_t i = 0; i < roster.size(); i++) {
+    entities.push_back(std::make_shared<Entity>(int(i) + 1));
+    int cell = int(i) * gridSize * gridSize / int(roster.size());
+    grid(cell / gridSize, cell % gridSize) = entities.back();
+  }
+  gameState.reset(
+      new GameState(fight, inventory, grid, entities, chunkSize));
+}
+
+void Match::move(int player, int direction) {
+  static const int kRowStep[] = {0, -1, 0, 1, 0};
+  static const int kColumnStep[] = {0, 0, 1, 0, -1};
+  int size = grid.getRows();
+  for (int row = 0; row < size; row++) {
+    for (int column = 0; column < size; column++) {
+      if (grid(row, column) != entities[player]) {
+        continue;
+      }
+      // Wraps around the edges; blocked by anything already there
+      int toRow = (row + kRowStep[direction] + size) % size;
+      int toColumn = (column + kColumnStep[direction] + size) % size;
+      if (grid(toRow, toColumn) == nullptr) {
+        grid(toRow, toColumn) = entities[player];
+        grid(row, column) = nullptr;
+      }
+      return;
+    }
+  }
+}
+
+void Match::step(const std::vector<PlayerInput>& inputs) {
+  if (inputs.size() != fight.size()) {
+    throw std::invalid_argument("Match::step needs one input per player");
+  }
+  for (uint32_t player = 0; player < fight.size(); player++) {
+    const PlayerInput& input = inputs[player];
+    if (input.move < 0 || input.move > 4) {
+      throw std::invalid_argument("No such move direction");
+    }
+    if (input.target >= 0 && fight.alive(player)) {
+      fight.attack(player, uint32_t(input.target));
+    }
+    if (input.item >= 0) {
+      Item* item = stock.at(input.item).get();
+      inventory.use(item);
+      if (item->getUsage() == 0) {
+        item->setUsage(100);
+      }
+    }
+    if (input.move > 0) {
+      move(int(player), input.move);
+    }
+  }
+  for (size_t i = 0; i < fight.size(); i++) {
+    if (!fight.alive(i)) {
+      fight[i].setHealth(100);
+    }
+  }
+  fight.endTick();
+}
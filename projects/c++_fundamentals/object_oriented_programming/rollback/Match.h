@@ -0,0 +1,65 @@
+#ifndef MATCH_H
+#define MATCH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "GameState.h"
+
+// One player's input for one tick
+struct PlayerInput {
+  int8_t target = -1;  // Character to attack, or -1
+  int8_t item = -1;    // Inventory item to use, or -1
+  int8_t move = 0;     // 0 stays, 1 to 4 moves up, right, down or left
+
+  friend bool operator==(const PlayerInput& lhs, const PlayerInput& rhs) {
+    return lhs.target == rhs.target && lhs.item == rhs.item &&
+           lhs.move == rhs.move;
+  }
+  friend bool operator!=(const PlayerInput& lhs, const PlayerInput& rhs) {
+    return !(lhs == rhs);
+  }
+};
+
+// What a player might press in a tick: mostly moves, now and then an
+// attack on another character or an item
+PlayerInput randomInput(std::mt19937& script, int player, int players,
+                        int items);
+
+// Characters fighting on a grid with a shared inventory, stepped one tick
+// at a time from every player's input. Player i controls character i of the
+// roster and the entity with id i + 1. A character that dies comes back with
+// full health the same tick; a used-up item is restocked.
+//
+// The game code reports on std::cout; silence it around step() when that
+// matters.
+class Match {
+ public:
+  Match(const std::vector<Combatant>& roster, int items, int gridSize,
+        size_t chunkSize = 256);
+
+  Match(const Match&) = delete;
+  Match& operator=(const Match&) = delete;
+
+  // inputs holds one PlayerInput per player
+  void step(const std::vector<PlayerInput>& inputs);
+
+  uint32_t tick() const { return fight.tick(); }
+  int players() const { return int(fight.size()); }
+  GameState& state() { return *gameState; }
+
+ private:
+  Fight fight;
+  std::vector<std::unique_ptr<Item>> stock;
+  Inventory inventory;
+  Grid grid;
+  std::vector<std::shared_ptr<Entity>> entities;
+  std::unique_ptr<GameState> gameState;
+
+  void move(int player, int direction);
+};
+
+#endif  // MATCH_H
@@ -0,0 +1,74 @@
+#include "StateImage.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+StateImage::StateImage(size_t size, size_t chunkSize)
+    : bytes(size, 0), chunkBytes(chunkSize) {
+  if (chunkSize == 0) {
+    throw std::invalid_argument("Chunk size must be at least one byte");
+  }
+  size_t chunks = (size + chunkSize - 1) / chunkSize;
+  // Nothing has been saved yet, so every chunk starts dirty
+  dirty.assign(chunks, true);
+  base.resize(chunks);
+}
+
+size_t StateImage::chunkLength(size_t chunk) const {
+  return std::min(chunkBytes, bytes.size() - chunk * chunkBytes);
+}
+
+void StateImage::write(size_t offset, const void* source, size_t count) {
+  if (offset > bytes.size() || count > bytes.size() - offset) {
+    throw std::out_of_range("Write past the end of the state image");
+  }
+  const uint8_t* from = static_cast<const uint8_t*>(source);
+  while (count > 0) {
+    size_t chunk = offset / chunkBytes;
+    size_t piece = std::min(count, (chunk + 1) * chunkBytes - offset);
+    uint8_t* to = bytes.data() + offset;
+    if (std::memcmp(to, from, piece) != 0) {
+      std::memcpy(to, from, piece);
+      dirty[chunk] = true;
+    }
+    offset += piece;
+    from += piece;
+    count -= piece;
+  }
+}
+
+size_t StateImage::dirtyCount() const {
+  return size_t(std::count(dirty.begin(), dirty.end(), true));
+}
+
+Snapshot StateImage::snapshot() {
+  Snapshot taken;
+  for (size_t i = 0; i < dirty.size(); i++) {
+    if (dirty[i]) {
+      const uint8_t* start = bytes.data() + i * chunkBytes;
+      base[i] = std::make_shared<const Chunk>(start, start + chunkLength(i));
+      taken.copied += chunkLength(i);
+      dirty[i] = false;
+    }
+  }
+  taken.chunks = base;
+  return taken;
+}
+
+std::vector<size_t> StateImage::restore(const Snapshot& snapshot) {
+  if (snapshot.chunks.size() != dirty.size()) {
+    throw std::invalid_argument("Snapshot is of a different state image");
+  }
+  std::vector<size_t> changed;
+  for (size_t i = 0; i < dirty.size(); i++) {
+    if (!dirty[i] && base[i] == snapshot.chunks[i]) {
+      continue;
+    }
+    std::memcpy(bytes.data() + i * chunkBytes, snapshot.chunks[i]->data(),
+                chunkLength(i));
+    base[i] = snapshot.chunks[i];
+    dirty[i] = false;
+    changed.push_back(i);
+  }
+  return changed;
+}
@@ -0,0 +1,84 @@
+#ifndef STATE_IMAGE_H
+#define STATE_IMAGE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+typedef std::vector<uint8_t> Chunk;
+
+// A saved StateImage. Chunks that did not change between two snapshots are
+// the same shared, immutable Chunk in both, so a snapshot costs one pointer
+// per chunk plus a copy of the chunks that changed.
+class Snapshot {
+ public:
+  size_t chunkCount() const { return chunks.size(); }
+  // Bytes this snapshot copied; the rest it shares with earlier ones
+  size_t copiedBytes() const { return copied; }
+
+ private:
+  friend class StateImage;
+  std::vector<std::shared_ptr<const Chunk>> chunks;
+  size_t copied = 0;
+};
+
+// Game state flattened into a byte image and split into equal chunks.
+//
+// Copy-on-write in software: a write marks only the chunks whose bytes
+// actually change as dirty, and snapshot() copies just those. Every chunk
+// also remembers which snapshot chunk it currently matches. restore() can
+// then skip any chunk that still matches the target snapshot, so its cost
+// follows how much changed since, not the size of the state.
+class StateImage {
+ public:
+  explicit StateImage(size_t size, size_t chunkSize = 256);
+
+  size_t size() const { return bytes.size(); }
+  size_t chunkSize() const { return chunkBytes; }
+  size_t chunkCount() const { return dirty.size(); }
+  const uint8_t* data() const { return bytes.data(); }
+
+  // Stores count bytes at offset; a write that changes nothing costs a
+  // compare. Throws std::out_of_range past the end of the image.
+  void write(size_t offset, const void* source, size_t count);
+
+  template <typename T>
+  void put(size_t offset, const T& value) {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Only trivially copyable values fit in an image");
+    write(offset, &value, sizeof(T));
+  }
+
+  template <typename T>
+  T get(size_t offset) const {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Only trivially copyable values fit in an image");
+    T value;
+    std::memcpy(&value, bytes.data() + offset, sizeof(T));
+    return value;
+  }
+
+  // Chunks written since the last snapshot or restore
+  size_t dirtyCount() const;
+
+  Snapshot snapshot();
+
+  // Makes the image equal to snapshot and returns the indices of the
+  // chunks that changed, in order. Throws std::invalid_argument for a
+  // snapshot of an image with a different chunk count.
+  std::vector<size_t> restore(const Snapshot& snapshot);
+
+ private:
+  std::vector<uint8_t> bytes;
+  size_t chunkBytes;
+  std::vector<bool> dirty;
+  // The snapshot chunk each chunk is equal to when not dirty
+  std::vector<std::shared_ptr<const Chunk>> base;
+
+  size_t chunkLength(size_t chunk) const;
+};
+
+#endif  // STATE_IMAGE_H
@@ -0,0 +1,181 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "Match.h"
+
+using std::cout;
+using std::endl;
+
+// Two peers play a match over a simulated connection, each running its own
+// copy with rollback.
+//
+// A peer simulates every tick as soon as its own player's input is known.
+// It predicts the other player did nothing. Inputs reach the other peer
+// after a random delay. When one arrives for a tick already simulated and
+// differs from the prediction, the peer loads the snapshot saved before
+// that tick and simulates forward again with the real input. At the end
+// both peers must agree with a reference copy that had every input on time.
+//
+// Usage: loopback [ticks] [max delay in ticks] [seed]
+
+const int kPlayers = 2;
+const int kItems = 6;
+const int kGridSize = 32;
+
+struct Message {
+  uint32_t arrival;  // Tick at which the other peer sees it
+  uint32_t tick;
+  PlayerInput input;
+};
+
+struct Peer {
+  int player;
+  std::unique_ptr<Match> match;
+  // Per tick, the inputs used: the remote one as received or predicted
+  std::vector<std::vector<PlayerInput>> inputs;
+  // snapshots[t % window] is the state before tick t was simulated
+  std::vector<Snapshot> snapshots;
+  std::vector<Message> inbox;
+
+  uint64_t rollbacks = 0, resimulated = 0, maxDepth = 0;
+  uint64_t saves = 0, loads = 0, copiedBytes = 0;
+  double saveSeconds = 0, loadSeconds = 0;
+
+  void saveBefore(uint32_t tick) {
+    auto begin = std::chrono::steady_clock::now();
+    Snapshot snapshot = match->state().save();
+    saveSeconds += std::chrono::duration<double>(
+                       std::chrono::steady_clock::now() - begin)
+                       .count();
+    copiedBytes += snapshot.copiedBytes();
+    saves++;
+    snapshots[tick % snapshots.size()] = std::move(snapshot);
+  }
+
+  void simulate(uint32_t tick) {
+    saveBefore(tick);
+    match->step(inputs[tick]);
+  }
+
+  // Applies the remote inputs that have arrived by now, rolling back if a
+  // prediction was wrong
+  void receive(uint32_t now) {
+    uint32_t rollbackTo = match->tick();
+    auto arrived = std::partition(
+        inbox.begin(), inbox.end(),
+        [now](const Message& message) { return message.arrival > now; });
+    for (auto it = arrived; it != inbox.end(); ++it) {
+      int remote = 1 - player;
+      if (it->tick >= inputs.size()) {
+        inputs.resize(it->tick + 1, std::vector<PlayerInput>(kPlayers));
+      }
+      if (inputs[it->tick][remote] != it->input) {
+        inputs[it->tick][remote] = it->input;
+        if (it->tick < match->tick()) {
+          rollbackTo = std::min(rollbackTo, it->tick);
+        }
+      }
+    }
+    inbox.erase(arrived, inbox.end());
+
+    uint32_t current = match->tick();
+    if (rollbackTo == current) {
+      return;
+    }
+    if (current - rollbackTo >= snapshots.size()) {
+      throw std::logic_error("Input arrived later than the rollback window");
+    }
+    auto begin = std::chrono::steady_clock::now();
+    match->state().load(snapshots[rollbackTo % snapshots.size()]);
+    loadSeconds += std::chrono::duration<double>(
+                       std::chrono::steady_clock::now() - begin)
+                       .count();
+    loads++;
+    rollbacks++;
+    maxDepth = std::max<uint64_t>(maxDepth, current - rollbackTo);
+    for (uint32_t tick = rollbackTo; tick < current; tick++) {
+      simulate(tick);
+      resimulated++;
+    }
+  }
+};
+
+int main(int argc, char* argv[]) {
+  uint32_t ticks = argc > 1 ? uint32_t(std::atoi(argv[1])) : 3600;
+  uint32_t maxDelay = argc > 2 ? uint32_t(std::atoi(argv[2])) : 8;
+  uint32_t seed = argc > 3 ? uint32_t(std::atoi(argv[3])) : 2024;
+
+  std::mt19937 seeds(seed);
+  std::vector<Combatant> roster = {
+      {CharacterClass::Warrior, "Thomas", uint32_t(seeds())},
+      {CharacterClass::Archer, "Edison", uint32_t(seeds())}};
+
+  // The game code reports every attack and item use; keep it quiet
+  Character::setLog(nullptr);
+  std::streambuf* console = cout.rdbuf(nullptr);
+
+  Match reference(roster, kItems, kGridSize);
+  Peer peers[kPlayers];
+  for (int p = 0; p < kPlayers; p++) {
+    peers[p].player = p;
+    peers[p].match.reset(new Match(roster, kItems, kGridSize));
+    peers[p].snapshots.resize(maxDelay + 2);
+  }
+
+  std::vector<std::mt19937> scripts = {std::mt19937(seeds()),
+                                       std::mt19937(seeds())};
+  std::mt19937 network(seeds());
+  std::uniform_int_distribution<uint32_t> delay(0, maxDelay);
+
+  for (uint32_t tick = 0; tick < ticks; tick++) {
+    std::vector<PlayerInput> actual(kPlayers);
+    for (int p = 0; p < kPlayers; p++) {
+      actual[p] = randomInput(scripts[p], p, kPlayers, kItems);
+    }
+    reference.step(actual);
+
+    for (int p = 0; p < kPlayers; p++) {
+      Peer& peer = peers[p];
+      peer.receive(tick);
+      if (tick >= peer.inputs.size()) {
+        peer.inputs.resize(tick + 1, std::vector<PlayerInput>(kPlayers));
+      }
+      // The remote input is either already here or predicted as idle
+      peer.inputs[tick][p] = actual[p];
+      peer.simulate(tick);
+      peers[1 - p].inbox.push_back({tick + delay(network), tick, actual[p]});
+    }
+  }
+  // Let everything still in flight arrive
+  for (Peer& peer : peers) {
+    peer.receive(ticks + maxDelay);
+  }
+
+  cout.rdbuf(console);
+  uint64_t expected = reference.state().hash();
+  bool agree = true;
+  cout << ticks << " ticks, inputs delayed by up to " << maxDelay
+       << " ticks, " << reference.state().image().size()
+       << " byte state in " << reference.state().image().chunkCount()
+       << " chunks" << endl;
+  for (Peer& peer : peers) {
+    bool same = peer.match->state().hash() == expected;
+    agree = agree && same;
+    cout << "Peer " << peer.player << ": " << peer.rollbacks
+         << " rollbacks, up to " << peer.maxDepth << " ticks deep, "
+         << peer.resimulated << " ticks resimulated" << endl
+         << "  save " << peer.saveSeconds / peer.saves * 1e6 << " us and "
+         << double(peer.copiedBytes) / peer.saves
+         << " bytes copied on average, load "
+         << (peer.loads ? peer.loadSeconds / peer.loads * 1e6 : 0) << " us"
+         << endl
+         << "  final state " << (same ? "matches" : "DIFFERS from")
+         << " the reference" << endl;
+  }
+  return agree ? 0 : 1;
+}
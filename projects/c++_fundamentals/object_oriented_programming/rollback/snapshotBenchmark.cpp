@@ -0,0 +1,103 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Match.h"
+
+using std::cout;
+using std::endl;
+
+// Snapshot size and save/restore time for different chunk sizes, on a match
+// of three characters with 30 items on a 64x64 grid. "whole" puts the state
+// in a single chunk, i.e. copies all of it on every save.
+//
+// Usage: snapshotBenchmark [frames]
+
+const int kItems = 30;
+const int kGridSize = 64;
+const size_t kHistory = 16;
+const int kRollbacks = 1000;
+
+double microsecondsSince(std::chrono::steady_clock::time_point begin) {
+  return std::chrono::duration<double, std::micro>(
+             std::chrono::steady_clock::now() - begin)
+      .count();
+}
+
+int main(int argc, char* argv[]) {
+  int frames = argc > 1 ? std::max(int(kHistory), std::atoi(argv[1])) : 5000;
+  std::vector<Combatant> roster = {{CharacterClass::Warrior, "Thomas", 1},
+                                   {CharacterClass::Mage, "Alex", 2},
+                                   {CharacterClass::Archer, "Edison", 3}};
+
+  Character::setLog(nullptr);
+  std::streambuf* console = cout.rdbuf(nullptr);
+  std::vector<std::string> lines;
+
+  for (size_t chunkSize : {size_t(64), size_t(256), size_t(1024),
+                           size_t(4096), size_t(1) << 30}) {
+    Match match(roster, kItems, kGridSize, chunkSize);
+    std::mt19937 script(7);
+    std::vector<PlayerInput> inputs(roster.size());
+    std::vector<Snapshot> history(kHistory);
+
+    double saveMicroseconds = 0;
+    uint64_t copied = 0;
+    for (int frame = 0; frame < frames; frame++) {
+      for (size_t p = 0; p < inputs.size(); p++) {
+        inputs[p] = randomInput(script, int(p), int(inputs.size()), kItems);
+      }
+      auto begin = std::chrono::steady_clock::now();
+      Snapshot snapshot = match.state().save();
+      saveMicroseconds += microsecondsSince(begin);
+      copied += snapshot.copiedBytes();
+      history[frame % kHistory] = std::move(snapshot);
+      match.step(inputs);
+    }
+
+    // Back and forth between the latest snapshot and an older one
+    size_t latest = (frames - 1) % kHistory;
+    double loadMicroseconds[2];
+    size_t depths[2] = {1, 8};
+    for (int d = 0; d < 2; d++) {
+      const Snapshot& older =
+          history[(latest + kHistory - depths[d]) % kHistory];
+      auto begin = std::chrono::steady_clock::now();
+      for (int i = 0; i < kRollbacks; i++) {
+        match.state().load(older);
+        match.state().load(history[latest]);
+      }
+      loadMicroseconds[d] = microsecondsSince(begin) / (2 * kRollbacks);
+    }
+
+    const StateImage& image = match.state().image();
+    std::ostringstream line;
+    line << std::setw(8)
+         << (image.chunkCount() == 1 ? std::string("whole")
+                                     : std::to_string(chunkSize))
+         << std::setw(8) << image.chunkCount() << std::fixed
+         << std::setprecision(2) << std::setw(10)
+         << saveMicroseconds / frames << std::setw(12) << std::setprecision(0)
+         << double(copied) / frames << std::setprecision(2) << std::setw(12)
+         << loadMicroseconds[0] << std::setw(12) << loadMicroseconds[1];
+    lines.push_back(line.str());
+  }
+
+  cout.rdbuf(console);
+  Match sample(roster, kItems, kGridSize);
+  cout << frames << " frames, " << sample.state().image().size()
+       << " bytes of state" << endl;
+  cout << std::setw(8) << "chunk" << std::setw(8) << "chunks" << std::setw(10)
+       << "save us" << std::setw(12) << "bytes/save" << std::setw(12)
+       << "load -1 us" << std::setw(12) << "load -8 us" << endl;
+  for (const std::string& line : lines) {
+    cout << line << endl;
+  }
+  return 0;
+}
@@ -0,0 +1,103 @@
+#ifndef PERSON_H
+#define PERSON_H
+
+#include <iostream>
+
+class Person {
+public:
+    explicit Person(int id = 0) : id(id) {}
+    virtual void Display() const = 0;
+    virtual ~Person() {}
+
+    int Id() const { return id; }
+
+private:
+    int id;
+};
+
+class Student : public Person {
+public:
+    Student(int id, int credits) : Person(id), credits(credits) {}
+
+    virtual void Study() = 0;
+    // Credits this student earns per term
+    virtual int Credits() const = 0;
+    void Display() const override {
+        std::cout << "Student\n";
+    }
+
+protected:
+    int credits;
+};
+
+class Undergraduate : public Student {
+public:
+    Undergraduate(int id = 0, int credits = 15) : Student(id, credits) {}
+
+    void Study() override {
+        std::cout << "Studying for a bachelor's degree\n";
+    }
+    int Credits() const override { return credits; }
+};
+
+class Graduate : public Student {
+public:
+    Graduate(int id = 0, int credits = 9, int researchCredits = 6)
+        : Student(id, credits), researchCredits(researchCredits) {}
+
+    void Study() override {
+        std::cout << "Studying for a master's or doctoral degree\n";
+    }
+    int Credits() const override { return credits + researchCredits; }
+
+private:
+    int researchCredits;
+};
+
+class Faculty : public Person {
+public:
+    Faculty(int id, int courses) : Person(id), courses(courses) {}
+
+    virtual void Teach() = 0;
+    // Hours per week spent with students
+    virtual int ContactHours() const = 0;
+    void Display() const override {
+        std::cout << "Faculty\n";
+    }
+
+protected:
+    int courses;
+};
+
+class Professor : public Faculty {
+public:
+    static const int kOfficeHours = 2;
+
+    Professor(int id = 0, int courses = 2) : Faculty(id, courses) {}
+
+    void Teach() override {
+        std::cout << "Teaching advanced classes\n";
+    }
+    int ContactHours() const override { return courses * 3 + kOfficeHours; }
+};
+
+class Instructor : public Faculty {
+public:
+    Instructor(int id = 0, int courses = 4) : Faculty(id, courses) {}
+
+    void Teach() override {
+        std::cout << "Teaching introductory classes\n";
+    }
+    int ContactHours() const override { return courses * 4; }
+};
+
+class Staff : public Person {
+public:
+    explicit Staff(int id = 0) : Person(id) {}
+
+    void Display() const override {
+        std::cout << "Staff\n";
+    }
+};
+
+#endif  // PERSON_H
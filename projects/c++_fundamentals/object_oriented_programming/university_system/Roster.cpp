@@ -0,0 +1,149 @@
+#include "Roster.h"
+
+#include <stdexcept>
+
+#include "Person.h"
+
+void Roster::append(Role role, size_t index) {
+    if (index > kMaxPerRole) {
+        throw std::length_error("Too many people with one role");
+    }
+    order.push_back(uint32_t(role) << kIndexBits | uint32_t(index));
+}
+
+void Roster::addUndergraduate(int id, int credits) {
+    append(Role::Undergraduate, undergraduateIds.size());
+    undergraduateIds.push_back(id);
+    undergraduateCredits.push_back(credits);
+}
+
+void Roster::addGraduate(int id, int credits, int researchCredits) {
+    append(Role::Graduate, graduateIds.size());
+    graduateIds.push_back(id);
+    graduateCredits.push_back(credits);
+    graduateResearch.push_back(researchCredits);
+}
+
+void Roster::addProfessor(int id, int courses) {
+    append(Role::Professor, professorIds.size());
+    professorIds.push_back(id);
+    professorCourses.push_back(courses);
+}
+
+void Roster::addInstructor(int id, int courses) {
+    append(Role::Instructor, instructorIds.size());
+    instructorIds.push_back(id);
+    instructorCourses.push_back(courses);
+}
+
+void Roster::addStaff(int id) {
+    append(Role::Staff, staffIds.size());
+    staffIds.push_back(id);
+}
+
+void Roster::reserve(size_t people) {
+    order.reserve(people);
+}
+
+size_t Roster::count(Role role) const {
+    switch (role) {
+        case Role::Undergraduate: return undergraduateIds.size();
+        case Role::Graduate: return graduateIds.size();
+        case Role::Professor: return professorIds.size();
+        case Role::Instructor: return instructorIds.size();
+        case Role::Staff: return staffIds.size();
+    }
+    return 0;
+}
+
+int Roster::idAt(size_t position) const {
+    uint32_t index = order[position] & kMaxPerRole;
+    switch (roleAt(position)) {
+        case Role::Undergraduate: return undergraduateIds[index];
+        case Role::Graduate: return graduateIds[index];
+        case Role::Professor: return professorIds[index];
+        case Role::Instructor: return instructorIds[index];
+        case Role::Staff: return staffIds[index];
+    }
+    return 0;
+}
+
+long long Roster::totalCredits() const {
+    long long total = 0;
+    for (int credits : undergraduateCredits) {
+        total += credits;
+    }
+    for (size_t i = 0; i < graduateCredits.size(); i++) {
+        total += graduateCredits[i] + graduateResearch[i];
+    }
+    return total;
+}
+
+long long Roster::totalContactHours() const {
+    long long total = 0;
+    for (int courses : professorCourses) {
+        total += courses * 3 + Professor::kOfficeHours;
+    }
+    for (int courses : instructorCourses) {
+        total += courses * 4;
+    }
+    return total;
+}
+
+void Roster::credits(std::vector<int>& out) const {
+    out.resize(undergraduateCredits.size() + graduateCredits.size());
+    size_t n = undergraduateCredits.size();
+    for (size_t i = 0; i < n; i++) {
+        out[i] = undergraduateCredits[i];
+    }
+    for (size_t i = 0; i < graduateCredits.size(); i++) {
+        out[n + i] = graduateCredits[i] + graduateResearch[i];
+    }
+}
+
+void Roster::contactHours(std::vector<int>& out) const {
+    out.resize(professorCourses.size() + instructorCourses.size());
+    size_t n = professorCourses.size();
+    for (size_t i = 0; i < n; i++) {
+        out[i] = professorCourses[i] * 3 + Professor::kOfficeHours;
+    }
+    for (size_t i = 0; i < instructorCourses.size(); i++) {
+        out[n + i] = instructorCourses[i] * 4;
+    }
+}
+
+void Roster::displayAll(std::ostream& out) const {
+    for (size_t i = 0; i < order.size(); i++) {
+        switch (roleAt(i)) {
+            case Role::Undergraduate:
+            case Role::Graduate:
+                out << "Student\n";
+                break;
+            case Role::Professor:
+            case Role::Instructor:
+                out << "Faculty\n";
+                break;
+            case Role::Staff:
+                out << "Staff\n";
+                break;
+        }
+    }
+}
+
+void Roster::studyAll(std::ostream& out) const {
+    for (size_t i = 0; i < undergraduateIds.size(); i++) {
+        out << "Studying for a bachelor's degree\n";
+    }
+    for (size_t i = 0; i < graduateIds.size(); i++) {
+        out << "Studying for a master's or doctoral degree\n";
+    }
+}
+
+void Roster::teachAll(std::ostream& out) const {
+    for (size_t i = 0; i < professorIds.size(); i++) {
+        out << "Teaching advanced classes\n";
+    }
+    for (size_t i = 0; i < instructorIds.size(); i++) {
+        out << "Teaching introductory classes\n";
+    }
+}
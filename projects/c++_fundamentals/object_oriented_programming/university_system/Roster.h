@@ -0,0 +1,71 @@
+#ifndef ROSTER_H
+#define ROSTER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+enum class Role : uint8_t {
+    Undergraduate,
+    Graduate,
+    Professor,
+    Instructor,
+    Staff
+};
+
+const int kRoleCount = 5;
+
+// Roster of people without a class hierarchy: each role has its own arrays,
+// one per field, and the roster order is a list of 32-bit tags (3 bits of
+// role, 29 bits of index into that role's arrays). Role-specific work runs
+// as a loop over one role's arrays, so there is no virtual call, no
+// dynamic_cast and no per-person allocation.
+class Roster {
+public:
+    static const int kIndexBits = 29;
+    static const uint32_t kMaxPerRole = (1u << kIndexBits) - 1;
+
+    void addUndergraduate(int id, int credits = 15);
+    void addGraduate(int id, int credits = 9, int researchCredits = 6);
+    void addProfessor(int id, int courses = 2);
+    void addInstructor(int id, int courses = 4);
+    void addStaff(int id);
+
+    void reserve(size_t people);
+
+    size_t size() const { return order.size(); }
+    size_t count(Role role) const;
+
+    // Role and id of the person at position in insertion order
+    Role roleAt(size_t position) const {
+        return static_cast<Role>(order[position] >> kIndexBits);
+    }
+    int idAt(size_t position) const;
+
+    // Batch passes over one role at a time
+    long long totalCredits() const;
+    long long totalContactHours() const;
+    // Credits per student: every undergraduate, then every graduate
+    void credits(std::vector<int>& out) const;
+    // Contact hours per faculty member: professors, then instructors
+    void contactHours(std::vector<int>& out) const;
+
+    // The same messages as Display/Study/Teach on the class hierarchy
+    void displayAll(std::ostream& out) const;
+    void studyAll(std::ostream& out) const;
+    void teachAll(std::ostream& out) const;
+
+private:
+    std::vector<uint32_t> order;
+
+    std::vector<int> undergraduateIds, undergraduateCredits;
+    std::vector<int> graduateIds, graduateCredits, graduateResearch;
+    std::vector<int> professorIds, professorCourses;
+    std::vector<int> instructorIds, instructorCourses;
+    std::vector<int> staffIds;
+
+    void append(Role role, size_t index);
+};
+
+#endif  // ROSTER_H
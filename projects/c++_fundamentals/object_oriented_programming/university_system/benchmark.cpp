@@ -0,0 +1,108 @@
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Person.h"
+#include "Roster.h"
+
+const int kRepeats = 10;
+
+template <typename Function>
+double nanosecondsPerPerson(size_t people, Function run) {
+    auto begin = std::chrono::steady_clock::now();
+    for (int r = 0; r < kRepeats; r++) {
+        run();
+    }
+    return std::chrono::duration<double, std::nano>(
+               std::chrono::steady_clock::now() - begin)
+               .count() /
+           (static_cast<double>(people) * kRepeats);
+}
+
+void printRow(const std::string& name, double ns, double baseline,
+              long long credits, long long hours) {
+    std::cout << std::setw(30) << name << std::setw(12) << ns
+              << std::setw(10) << baseline / ns << std::setw(14) << credits
+              << std::setw(14) << hours << "\n";
+}
+
+// Total credits and contact hours over a mixed roster: dynamic_cast on
+// heap-allocated people against the per-role roster
+int main(int argc, char* argv[]) {
+    size_t people = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> role(0, kRoleCount - 1);
+    std::uniform_int_distribution<int> load(1, 6);
+    std::vector<Person*> university;
+    Roster roster;
+    roster.reserve(people);
+    for (size_t i = 0; i < people; i++) {
+        int id = static_cast<int>(i);
+        int amount = load(rng);
+        switch (static_cast<Role>(role(rng))) {
+            case Role::Undergraduate:
+                university.push_back(new Undergraduate(id, amount * 3));
+                roster.addUndergraduate(id, amount * 3);
+                break;
+            case Role::Graduate:
+                university.push_back(new Graduate(id, amount * 2, amount));
+                roster.addGraduate(id, amount * 2, amount);
+                break;
+            case Role::Professor:
+                university.push_back(new Professor(id, amount));
+                roster.addProfessor(id, amount);
+                break;
+            case Role::Instructor:
+                university.push_back(new Instructor(id, amount));
+                roster.addInstructor(id, amount);
+                break;
+            case Role::Staff:
+                university.push_back(new Staff(id));
+                roster.addStaff(id);
+                break;
+        }
+    }
+
+    std::cout << people << " people, " << kRepeats << " passes\n";
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << std::setw(30) << "strategy" << std::setw(12) << "ns/person"
+              << std::setw(10) << "speedup" << std::setw(14) << "credits"
+              << std::setw(14) << "hours" << "\n";
+
+    long long castCredits = 0, castHours = 0;
+    double castNs = nanosecondsPerPerson(people, [&]() {
+        castCredits = 0;
+        castHours = 0;
+        for (Person* person : university) {
+            if (Student* student = dynamic_cast<Student*>(person)) {
+                castCredits += student->Credits();
+            }
+            else if (Faculty* faculty = dynamic_cast<Faculty*>(person)) {
+                castHours += faculty->ContactHours();
+            }
+        }
+    });
+    printRow("vector<Person*> + dynamic_cast", castNs, castNs, castCredits,
+             castHours);
+
+    long long rosterCredits = 0, rosterHours = 0;
+    double rosterNs = nanosecondsPerPerson(people, [&]() {
+        rosterCredits = roster.totalCredits();
+        rosterHours = roster.totalContactHours();
+    });
+    printRow("Roster batch passes", rosterNs, castNs, rosterCredits,
+             rosterHours);
+
+    for (Person* person : university) {
+        delete person;
+    }
+
+    bool same = castCredits == rosterCredits && castHours == rosterHours;
+    std::cout << "Results match: " << (same ? "yes" : "NO") << "\n";
+    return same ? 0 : 1;
+}
@@ -1,62 +1,8 @@
 #include <iostream>
 #include <vector>
 
-class Person {
-public:
-    virtual void Display() const = 0;
-    virtual ~Person() {} 
-};
-
-class Student : public Person {
-public:
-    virtual void Study() = 0;  
-    void Display() const override {
-        std::cout << "Student\n";
-    }
-};
-
-class Undergraduate : public Student {
-public:
-    void Study() override {
-        std::cout << "Studying for a bachelor's degree\n";
-    }
-};
-
-class Graduate : public Student {
-public:
-    void Study() override {
-        std::cout << "Studying for a master's or doctoral degree\n";
-    }
-};
-
-class Faculty : public Person {
-public:
-    virtual void Teach() = 0;  
-    void Display() const override {
-        std::cout << "Faculty\n";
-    }
-};
-
-class Professor : public Faculty {
-public:
-    void Teach() override {
-        std::cout << "Teaching advanced classes\n";
-    }
-};
-
-class Instructor : public Faculty {
-public:
-    void Teach() override {
-        std::cout << "Teaching introductory classes\n";
-    }
-};
-
-class Staff : public Person {
-public:
-    void Display() const override {
-        std::cout << "Staff\n";
-    }
-};
+#include "Person.h"
+#include "Roster.h"
 
 int main() {
     std::vector<Person*> university;
@@ -82,5 +28,20 @@ int main() {
         delete person;
     }
 
+    // The same people in a roster, processed one role at a time
+    Roster roster;
+    roster.addUndergraduate(1);
+    roster.addGraduate(2);
+    roster.addProfessor(3);
+    roster.addInstructor(4);
+    roster.addStaff(5);
+
+    std::cout << "\n";
+    roster.studyAll(std::cout);
+    roster.teachAll(std::cout);
+    std::cout << "Total credits: " << roster.totalCredits()
+              << ", total contact hours: " << roster.totalContactHours()
+              << "\n";
+
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,267 @@
+#include "Profiler.h"
+
+#if defined(GAME_DEV_PROFILE)
+
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <new>
+
+namespace profileDetail {
+
+thread_local uint64_t allocations = 0;
+thread_local uint64_t allocatedBytes = 0;
+
+}  // namespace profileDetail
+
+namespace {
+
+struct ProfileEvent {
+  const ProfileSite* site;
+  uint64_t start;
+  uint64_t end;
+  uint64_t allocations;
+};
+
+// Written only by its own thread. written counts every event ever recorded;
+// the last min(written, capacity) of them are still in the ring.
+struct ThreadRing {
+  explicit ThreadRing(uint32_t threadId)
+      : threadId(threadId), events(new ProfileEvent[kProfileRingCapacity]) {}
+
+  uint32_t threadId;
+  std::atomic<uint64_t> written{0};
+  std::unique_ptr<ProfileEvent[]> events;
+};
+
+struct ClockPoint {
+  uint64_t ticks;
+  std::chrono::steady_clock::time_point time;
+
+  static ClockPoint now() {
+    return {profileDetail::timestamp(), std::chrono::steady_clock::now()};
+  }
+};
+
+std::atomic<ProfileSite*> siteList{nullptr};
+
+// Rings outlive their threads, so a trace can be written after joining. A
+// thread that exits puts its ring on freeRings and the next thread to
+// record a zone carries on in it, so a program that keeps starting threads
+// needs only as many rings as it ever has threads at once.
+std::mutex ringsMutex;
+std::vector<std::unique_ptr<ThreadRing>> rings;
+std::vector<ThreadRing*> freeRings;
+
+void releaseRing(ThreadRing* ring) {
+  std::lock_guard<std::mutex> lock(ringsMutex);
+  freeRings.push_back(ring);
+}
+
+// The current thread's ring, handed back when the thread exits
+struct RingLease {
+  ThreadRing* ring = nullptr;
+
+  ~RingLease() {
+    if (ring != nullptr) {
+      releaseRing(ring);
+      ring = nullptr;
+    }
+  }
+};
+
+thread_local RingLease threadRing;
+
+// The tick rate is measured between program start and the export
+const ClockPoint programStart = ClockPoint::now();
+
+ThreadRing* registerThread() {
+  std::lock_guard<std::mutex> lock(ringsMutex);
+  if (!freeRings.empty()) {
+    ThreadRing* ring = freeRings.back();
+    freeRings.pop_back();
+    return ring;
+  }
+  rings.emplace_back(new ThreadRing(uint32_t(rings.size() + 1)));
+  return rings.back().get();
+}
+
+double ticksPerMicrosecond() {
+  const std::chrono::milliseconds minimumSpan(10);
+  ClockPoint current = ClockPoint::now();
+  while (current.time - programStart.time < minimumSpan) {
+    current = ClockPoint::now();
+  }
+  double microseconds = std::chrono::duration<double, std::micro>(
+                            current.time - programStart.time)
+                            .count();
+  return double(current.ticks - programStart.ticks) / microseconds;
+}
+
+void writeJsonString(std::ostream& out, const char* text) {
+  out << '"';
+  for (; *text; text++) {
+    char c = *text;
+    if (c == '"' || c == '\\') {
+      out << '\\' << c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << int(c)
+          << std::dec << std::setfill(' ');
+    } else {
+      out << c;
+    }
+  }
+  out << '"';
+}
+
+}  // namespace
+
+ProfileSite::ProfileSite(const char* name) : name(name) {
+  next = siteList.load(std::memory_order_relaxed);
+  while (!siteList.compare_exchange_weak(next, this, std::memory_order_release,
+                                         std::memory_order_relaxed)) {
+  }
+}
+
+void profileDetail::record(ProfileSite& site, uint64_t start, uint64_t end,
+                           uint64_t allocations, uint64_t allocatedBytes) {
+  site.calls.fetch_add(1, std::memory_order_relaxed);
+  site.ticks.fetch_add(end - start, std::memory_order_relaxed);
+  if (allocations > 0) {
+    site.allocations.fetch_add(allocations, std::memory_order_relaxed);
+    site.allocatedBytes.fetch_add(allocatedBytes, std::memory_order_relaxed);
+  }
+
+  // The first zone on a thread takes a ring, allocating one if none is
+  // free; that allocation is charged to any zone enclosing this one
+  ThreadRing*& ring = threadRing.ring;
+  if (ring == nullptr) {
+    ring = registerThread();
+  }
+  uint64_t index = ring->written.load(std::memory_order_relaxed);
+  ring->events[index % kProfileRingCapacity] = {&site, start, end,
+                                                allocations};
+  ring->written.store(index + 1, std::memory_order_release);
+}
+
+std::vector<ProfileSiteStats> profileSiteStats() {
+  double rate = ticksPerMicrosecond();
+  std::vector<ProfileSiteStats> stats;
+  for (ProfileSite* site = siteList.load(std::memory_order_acquire); site;
+       site = site->next) {
+    uint64_t calls = site->calls.load(std::memory_order_relaxed);
+    if (calls == 0) {
+      continue;
+    }
+    stats.push_back({site->name, calls,
+                     site->allocations.load(std::memory_order_relaxed),
+                     site->allocatedBytes.load(std::memory_order_relaxed),
+                     site->ticks.load(std::memory_order_relaxed) / rate});
+  }
+  return stats;
+}
+
+void writeChromeTrace(std::ostream& out) {
+  double rate = ticksPerMicrosecond();
+  std::lock_guard<std::mutex> lock(ringsMutex);
+
+  // Timestamps start at the earliest buffered zone
+  uint64_t base = UINT64_MAX, last = 0;
+  for (const auto& ring : rings) {
+    uint64_t written = ring->written.load(std::memory_order_acquire);
+    uint64_t first = written > kProfileRingCapacity
+                         ? written - kProfileRingCapacity
+                         : 0;
+    for (uint64_t i = first; i < written; i++) {
+      const ProfileEvent& event = ring->events[i % kProfileRingCapacity];
+      base = std::min(base, event.start);
+      last = std::max(last, event.end);
+    }
+  }
+  if (base == UINT64_MAX) {
+    base = last;
+  }
+
+  std::ios::fmtflags flags = out.flags();
+  out << std::fixed << std::setprecision(3);
+  out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+  const char* separator = "";
+  for (const auto& ring : rings) {
+    out << separator << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,"
+        << "\"tid\":" << ring->threadId << ",\"args\":{\"name\":\"thread "
+        << ring->threadId << "\"}}";
+    separator = ",\n";
+
+    uint64_t written = ring->written.load(std::memory_order_acquire);
+    uint64_t first = written > kProfileRingCapacity
+                         ? written - kProfileRingCapacity
+                         : 0;
+    for (uint64_t i = first; i < written; i++) {
+      const ProfileEvent& event = ring->events[i % kProfileRingCapacity];
+      out << separator << "{\"name\":";
+      writeJsonString(out, event.site->name);
+      out << ",\"cat\":\"zone\",\"ph\":\"X\",\"pid\":1,\"tid\":"
+          << ring->threadId << ",\"ts\":" << (event.start - base) / rate
+          << ",\"dur\":" << (event.end - event.start) / rate
+          << ",\"args\":{\"allocations\":" << event.allocations << "}}";
+    }
+  }
+
+  // Totals, as counter tracks with a single sample at the end of the trace
+  for (ProfileSite* site = siteList.load(std::memory_order_acquire); site;
+       site = site->next) {
+    if (site->calls.load(std::memory_order_relaxed) == 0) {
+      continue;
+    }
+    out << separator << "{\"name\":";
+    writeJsonString(out, site->name);
+    out << ",\"ph\":\"C\",\"pid\":1,\"ts\":" << (last - base) / rate
+        << ",\"args\":{\"calls\":"
+        << site->calls.load(std::memory_order_relaxed)
+        << ",\"allocations\":"
+        << site->allocations.load(std::memory_order_relaxed) << "}}";
+    separator = ",\n";
+  }
+  out << "\n]}\n";
+  out.flags(flags);
+}
+
+void resetProfiler() {
+  for (ProfileSite* site = siteList.load(std::memory_order_acquire); site;
+       site = site->next) {
+    site->calls.store(0, std::memory_order_relaxed);
+    site->allocations.store(0, std::memory_order_relaxed);
+    site->allocatedBytes.store(0, std::memory_order_relaxed);
+    site->ticks.store(0, std::memory_order_relaxed);
+  }
+  std::lock_guard<std::mutex> lock(ringsMutex);
+  for (const auto& ring : rings) {
+    ring->written.store(0, std::memory_order_relaxed);
+  }
+}
+
+// Counting replacements for the global allocation functions. The array and
+// nothrow forms call these; the over-aligned forms are not counted.
+
+void* operator new(std::size_t size) {
+  profileDetail::allocations++;
+  profileDetail::allocatedBytes += size;
+  while (true) {
+    if (void* memory = std::malloc(size > 0 ? size : 1)) {
+      return memory;
+    }
+    std::new_handler handler = std::get_new_handler();
+    if (handler == nullptr) {
+      throw std::bad_alloc();
+    }
+    handler();
+  }
+}
+
+void operator delete(void* memory) noexcept { std::free(memory); }
+
+void operator delete(void* memory, std::size_t) noexcept { std::free(memory); }
+
+#endif  // GAME_DEV_PROFILE
@@ -0,0 +1,148 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// A scoped-zone profiler for the hot paths of the game code.
+//
+// PROFILE_ZONE("name") at the top of a block times the block. On the way
+// out the zone is written to a ring buffer owned by the current thread, and
+// the per-zone totals are updated: calls, time, and the operator new
+// allocations made inside the zone. Timestamps are raw rdtsc ticks on x86
+// and are converted to microseconds only when the trace is exported.
+//
+// Zones exist only when GAME_DEV_PROFILE is defined, which the CMake option
+// GAME_DEV_PROFILER=ON does for the whole build. Otherwise PROFILE_ZONE
+// expands to nothing, the functions below return empty results and the
+// instrumented code is exactly what it was before.
+
+// Totals for one PROFILE_ZONE across every thread
+struct ProfileSiteStats {
+  std::string name;
+  uint64_t calls;
+  uint64_t allocations;     // operator new calls inside the zone
+  uint64_t allocatedBytes;  // Bytes requested by those calls
+  double totalMicroseconds;
+};
+
+#if defined(GAME_DEV_PROFILE)
+
+#include <atomic>
+#include <chrono>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+// Events each thread keeps; older ones are overwritten. A ring is about
+// 2 MB. When its thread exits it is reused by the next thread that records
+// a zone, which continues after the events already in it, so the trace
+// shows threads that shared a ring as one track.
+const size_t kProfileRingCapacity = size_t(1) << 16;
+
+// One per PROFILE_ZONE in the source. Sites are function-local statics that
+// link themselves into a global list the first time their zone runs.
+class ProfileSite {
+ public:
+  explicit ProfileSite(const char* name);
+
+  ProfileSite(const ProfileSite&) = delete;
+  ProfileSite& operator=(const ProfileSite&) = delete;
+
+  const char* const name;
+  // Relaxed atomics: a zone can run on several threads at once, and only
+  // the totals need to be right
+  std::atomic<uint64_t> calls{0};
+  std::atomic<uint64_t> allocations{0};
+  std::atomic<uint64_t> allocatedBytes{0};
+  std::atomic<uint64_t> ticks{0};
+  ProfileSite* next;
+};
+
+namespace profileDetail {
+
+// Updated by the replacement operator new in Profiler.cpp
+extern thread_local uint64_t allocations;
+extern thread_local uint64_t allocatedBytes;
+
+inline uint64_t timestamp() {
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#else
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+#endif
+}
+
+// Appends the zone to this thread's ring and adds it to the site's totals
+void record(ProfileSite& site, uint64_t start, uint64_t end,
+            uint64_t allocations, uint64_t allocatedBytes);
+
+}  // namespace profileDetail
+
+// The RAII marker behind PROFILE_ZONE
+class ProfileZone {
+ public:
+  explicit ProfileZone(ProfileSite& site)
+      : site(site),
+        allocationsAtStart(profileDetail::allocations),
+        bytesAtStart(profileDetail::allocatedBytes),
+        start(profileDetail::timestamp()) {}
+
+  ~ProfileZone() {
+    uint64_t end = profileDetail::timestamp();
+    profileDetail::record(site, start, end,
+                          profileDetail::allocations - allocationsAtStart,
+                          profileDetail::allocatedBytes - bytesAtStart);
+  }
+
+  ProfileZone(const ProfileZone&) = delete;
+  ProfileZone& operator=(const ProfileZone&) = delete;
+
+ private:
+  ProfileSite& site;
+  uint64_t allocationsAtStart;
+  uint64_t bytesAtStart;
+  uint64_t start;
+};
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_ZONE(name)                                                 \
+  static ProfileSite PROFILE_CONCAT(profileSite, __LINE__)(name);          \
+  ProfileZone PROFILE_CONCAT(profileZone, __LINE__)(                       \
+      PROFILE_CONCAT(profileSite, __LINE__))
+
+// Totals for every zone that has run at least once, by name
+std::vector<ProfileSiteStats> profileSiteStats();
+
+// Writes every buffered zone as a Chrome trace (chrome://tracing or
+// https://ui.perfetto.dev), followed by one counter event per site with its
+// calls and allocations. The rings are read without locking, so call this
+// while the profiled threads are idle, e.g. after joining them.
+void writeChromeTrace(std::ostream& out);
+
+// Empties the rings and zeroes the totals; same caveat as writeChromeTrace
+void resetProfiler();
+
+#else
+
+#define PROFILE_ZONE(name) static_cast<void>(0)
+
+inline std::vector<ProfileSiteStats> profileSiteStats() {
+  return std::vector<ProfileSiteStats>();
+}
+
+inline void writeChromeTrace(std::ostream& out) {
+  out << "{\"traceEvents\":[]}\n";
+}
+
+inline void resetProfiler() {}
+
+#endif  // GAME_DEV_PROFILE
+
+#endif  // PROFILER_H
@@ -0,0 +1,113 @@
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../object_oriented_programming/basic_game_characters/CharacterClasses.h"
+#include "../object_oriented_programming/game_events/GameTimeline.h"
+#include "../object_oriented_programming/grid_based_game/Grid.h"
+#include "../object_oriented_programming/invetory_system/Inventory.h"
+#include "Profiler.h"
+
+// Runs the instrumented paths on a few threads, then writes a Chrome trace
+// and prints the per-zone counters.
+//
+// Usage: profileDemo [trace file] [rounds]
+// Needs a build with -DGAME_DEV_PROFILER=ON to record anything.
+
+void playRounds(int rounds) {
+  Warrior warrior("Thomas");
+  Mage mage("Alex");
+  Archer archer("Edison");
+
+  Inventory inventory;
+  Potion potion;
+  Weapon weapon;
+  Armor armor;
+  inventory.add(&potion);
+  inventory.add(&weapon);
+  inventory.add(&armor);
+
+  std::vector<std::unique_ptr<GameEvent<int>>> events;
+  GameTimeline<int> timeline;
+  for (int i = 0; i < 200; i++) {
+    events.emplace_back(new GameEvent<int>("spawn_enemy", i % 20));
+    timeline.addEvent(events.back().get());
+  }
+
+  Grid grid(32, 32);
+  auto entity = std::make_shared<Entity>(1);
+
+  for (int round = 0; round < rounds; round++) {
+    warrior.attack(mage);
+    mage.attack(archer);
+    archer.attack(warrior);
+    warrior.setHealth(100);
+    mage.setHealth(100);
+    archer.setHealth(100);
+
+    inventory.use(&potion);
+    inventory.use(&weapon);
+    inventory.use(&armor);
+    weapon.setUsage(100);
+
+    timeline.getEventsAtTime(round % 20);
+
+    for (int cell = 0; cell < 32; cell++) {
+      grid((round + cell) % 32, cell) = cell % 4 == 0 ? entity : nullptr;
+    }
+  }
+}
+
+int main(int argc, char* argv[]) {
+  std::string tracePath = argc > 1 ? argv[1] : "trace.json";
+  int rounds = argc > 2 ? std::stoi(argv[2]) : 1000;
+
+#if !defined(GAME_DEV_PROFILE)
+  cout << "Profiling is compiled out; reconfigure with "
+          "-DGAME_DEV_PROFILER=ON to record zones"
+       << endl;
+#endif
+
+  // The game code reports everything on cout; keep it quiet while playing
+  std::streambuf* console = cout.rdbuf(nullptr);
+  std::vector<std::thread> players;
+  for (int i = 0; i < 3; i++) {
+    players.emplace_back(playRounds, rounds);
+  }
+  for (std::thread& player : players) {
+    player.join();
+  }
+  cout.rdbuf(console);
+  cout.clear();
+
+  std::ofstream trace(tracePath);
+  writeChromeTrace(trace);
+  if (!trace) {
+    std::cerr << "Cannot write " << tracePath << endl;
+    return 1;
+  }
+
+  std::vector<ProfileSiteStats> stats = profileSiteStats();
+  std::sort(stats.begin(), stats.end(),
+            [](const ProfileSiteStats& a, const ProfileSiteStats& b) {
+              return a.totalMicroseconds > b.totalMicroseconds;
+            });
+  cout << std::left << std::setw(32) << "zone" << std::right << std::setw(10)
+       << "calls" << std::setw(12) << "total us" << std::setw(10) << "ns/call"
+       << std::setw(10) << "allocs" << std::setw(12) << "bytes" << endl;
+  for (const ProfileSiteStats& site : stats) {
+    cout << std::left << std::setw(32) << site.name << std::right
+         << std::setw(10) << site.calls << std::setw(12) << std::fixed
+         << std::setprecision(0) << site.totalMicroseconds << std::setw(10)
+         << std::setprecision(1) << site.totalMicroseconds * 1000 / site.calls
+         << std::setw(10) << site.allocations << std::setw(12)
+         << site.allocatedBytes << endl;
+  }
+  cout << "Trace written to " << tracePath << endl;
+  return 0;
+}
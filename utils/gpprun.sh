@@ -1,13 +1,32 @@
 #!/bin/bash
 
-# Get the name of the C++ source files from the command-line arguments
+# Builds the program whose main() is in the given C++ source file and runs it.
+#
+# Programs that are part of the CMake build are built with it, optimized and
+# with their libraries, in $BUILD_DIR (default: build/release, shared with
+# the "release" preset) using $BUILD_TYPE (default: Release). Extra sources are
+# then ignored, since CMake already knows what each program needs. Anything
+# else is compiled directly with g++, as before.
+#
+# Usage: gpprun.sh <main source> [other sources...] [-- program arguments...]
+
 if [ -z "$1" ]; then
     echo "Please specify at least one C++ source file."
     exit 1
 fi
 
+# Source files come first; everything after "--" goes to the program
+sources=()
+while [ $# -gt 0 ] && [ "$1" != "--" ]; do
+    sources+=("$1")
+    shift
+done
+if [ "$1" == "--" ]; then
+    shift
+fi
+
 # Check all files exist
-for filename in "$@"; do
+for filename in "${sources[@]}"; do
     if [ ! -f "$filename" ]; then
         echo "File not found: $filename"
         exit 1
@@ -16,19 +35,41 @@ done
 
 # Get the directory where the script is located
 script_dir="$( cd "$( dirname "${BASH_SOURCE[0]}" )" >/dev/null 2>&1 && pwd )"
+repo_dir="$( dirname "$script_dir" )"
+build_dir="${BUILD_DIR:-$repo_dir/build/release}"
+build_type="${BUILD_TYPE:-Release}"
+
+source_dir="$( cd "$( dirname "${sources[0]}" )" && pwd )"
+program_name="$( basename "${sources[0]%.*}" )"
+target="$( basename "$source_dir" )_$program_name"
+relative_dir="${source_dir#"$repo_dir"/}"
 
-# Change to the directory where the first C++ source file is located
-cd "$( dirname "$1" )"
+if command -v cmake >/dev/null 2>&1 && [ "$relative_dir" != "$source_dir" ]; then
+    if [ ! -f "$build_dir/CMakeCache.txt" ]; then
+        cmake -S "$repo_dir" -B "$build_dir" -DCMAKE_BUILD_TYPE="$build_type" \
+            >/dev/null || exit 1
+    fi
+    if grep -q "/$target.dir\$" "$build_dir/CMakeFiles/TargetDirectories.txt"; then
+        cmake --build "$build_dir" --target "$target" -j"$(nproc)" >/dev/null
+        if [ $? -ne 0 ]; then
+            # Run again to show the errors
+            cmake --build "$build_dir" --target "$target"
+            echo "Compilation failed."
+            exit 1
+        fi
+        exec "$build_dir/$relative_dir/$program_name" "$@"
+    fi
+fi
 
-# Compile and run the C++ program
-# We use the name of the first source file to derive the program name
-program_name="${1%.*}"
-g++ -std=c++11 -o "$program_name".out "$@"
+# Not a CMake target: compile directly next to the first source
+absolute_sources=()
+for filename in "${sources[@]}"; do
+    absolute_sources+=("$( cd "$( dirname "$filename" )" && pwd )/$( basename "$filename" )")
+done
+cd "$source_dir"
+g++ -std=c++17 -O2 -pthread -o "$program_name".out "${absolute_sources[@]}"
 if [ $? -ne 0 ]; then
     echo "Compilation failed."
     exit 1
 fi
-"./$program_name".out
-
-# Change back to the original directory
-cd "$script_dir"
\ No newline at end of file
+"./$program_name".out "$@"